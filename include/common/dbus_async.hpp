@@ -0,0 +1,576 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/exception.hpp>
+#include <sdbusplus/message.hpp>
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace dbus_async
+{
+
+/**
+ * @brief The D-Bus method reply handler
+ *
+ * @param[in] reply - The method reply message
+ * @param[in] error - The D-Bus error if the method call is failed
+ *                    (for example, method error reply or timeout) and
+ *                    the reply should not be read, nullptr otherwise.
+ */
+using ReplyHandler = std::function<void(sdbusplus::message::message& reply,
+                                        const sd_bus_error* error)>;
+
+/**
+ * @brief The callback to invoke when no D-Bus method call is pending
+ */
+using IdleHandler = std::function<void()>;
+
+class CallAwaiter;
+
+/**
+ * @class CallPipeline
+ *
+ * @brief Used to issue the D-Bus method calls asynchronously with
+ *        the bounded concurrency.
+ *
+ * @details The D-Bus method calls are sent without waiting for the previous
+ *          call reply (up to the given maximum in-flight calls) and the reply
+ *          handlers are invoked as the replies arrive so, the total latency
+ *          is bounded by the slowest D-Bus service instead of the sum of
+ *          all the D-Bus method calls latency.
+ *
+ * @note The replies are dispatched by the sd_event loop that the bus is
+ *       attached to, or by waitIdle() if the event loop is not running yet.
+ *
+ * @note The suspended coroutines which are waiting for the reply are
+ *       resumed with the ECANCELED error when the pipeline is destroyed,
+ *       and the other in-flight D-Bus method calls are dropped.
+ */
+class CallPipeline
+{
+  public:
+    CallPipeline() = delete;
+    CallPipeline(const CallPipeline&) = delete;
+    CallPipeline& operator=(const CallPipeline&) = delete;
+    CallPipeline(CallPipeline&&) = delete;
+    CallPipeline& operator=(CallPipeline&&) = delete;
+
+    /**
+     * @brief Constructor to create the pipeline on the given bus
+     *
+     * @param[in] bus - Bus to attach to.
+     * @param[in] maxInFlight - The maximum D-Bus method calls to send
+     *                          without waiting for the reply.
+     */
+    CallPipeline(sdbusplus::bus::bus& bus, size_t maxInFlight);
+
+    /** @brief Cancel all pending and in-flight D-Bus method calls */
+    ~CallPipeline();
+
+    /**
+     * @brief Used to add the D-Bus method call into the pipeline
+     *
+     * @param[in] method - The D-Bus method call message
+     * @param[in] handler - The handler to invoke with the reply
+     *
+     * @return NULL
+     *
+     * @note The handler is invoked with the D-Bus error if failed to send
+     *       the D-Bus method call.
+     */
+    void call(sdbusplus::message::message&& method, ReplyHandler handler);
+
+    /**
+     * @brief Used to add the D-Bus method call into the pipeline and
+     *        suspend the calling coroutine until the reply arrives
+     *
+     * @param[in] method - The D-Bus method call message
+     *
+     * @return The awaitable which gives the reply message on success
+     *         Throw SdBusError exception on failure
+     */
+    CallAwaiter awaitCall(sdbusplus::message::message&& method);
+
+    /**
+     * @brief Used to add the callback to invoke once all the D-Bus method
+     *        calls (including the calls which are added by the reply
+     *        handlers) are completed.
+     *
+     * @param[in] handler - The callback to invoke
+     *
+     * @return NULL
+     *
+     * @note The callback is invoked immediately if the pipeline is idle.
+     */
+    void onIdle(IdleHandler handler);
+
+    /**
+     * @brief Used to check whether any D-Bus method call is pending
+     *
+     * @return true if no D-Bus method call is pending
+     *         false otherwise
+     */
+    bool idle() const;
+
+    /**
+     * @brief Used to send the next D-Bus method calls on a private bus
+     *        connection until waitIdle() is completed.
+     *
+     * @details The private bus connection doesn't own any bus name, object
+     *          and match rule so, only the D-Bus method call replies are
+     *          received on it, and the D-Bus method calls and signals of
+     *          the shared bus are not dispatched by waitIdle().
+     *
+     * @return NULL
+     *
+     * @note The shared bus is used if failed to open the private bus
+     *       connection or any D-Bus method call is pending.
+     */
+    void usePrivateBus();
+
+    /**
+     * @brief Used to process the bus until all the D-Bus method calls
+     *        are completed.
+     *
+     * @return NULL
+     *
+     * @note This should be used only if the sd_event loop is not running
+     *       (for example, restore at the startup).
+     *
+     * @note Only the D-Bus method call replies are processed if the D-Bus
+     *       method calls are sent on the private bus connection (please
+     *       refer usePrivateBus()), and the private bus connection is
+     *       closed once all the D-Bus method calls are completed.
+     */
+    void waitIdle();
+
+  private:
+    /**
+     * @brief The D-Bus method call details
+     */
+    struct Call
+    {
+        sdbusplus::message::message method;
+        ReplyHandler handler;
+        sd_bus_slot* slot{nullptr};
+        CallPipeline* pipeline{nullptr};
+
+        /**
+         * @brief Used to indicate whether the handler must be invoked with
+         *        the error if the call is cancelled (for example, to resume
+         *        the suspended coroutine).
+         */
+        bool handleCancel{false};
+    };
+
+    /**
+     * @brief Attached bus connection
+     */
+    sdbusplus::bus::bus& _bus;
+
+    /**
+     * @brief The private bus connection to send the D-Bus method calls
+     *        until waitIdle() is completed.
+     */
+    std::optional<sdbusplus::bus::bus> _privateBus;
+
+    /**
+     * @brief Used to indicate whether the pipeline is being destroyed
+     */
+    bool _cancelled{false};
+
+    /**
+     * @brief The maximum D-Bus method calls to send without waiting for
+     *        the reply.
+     */
+    size_t _maxInFlight;
+
+    /**
+     * @brief The D-Bus method calls which are waiting to send
+     */
+    std::deque<std::unique_ptr<Call>> _pendingCalls;
+
+    /**
+     * @brief The D-Bus method calls which are waiting for the reply
+     */
+    std::vector<std::unique_ptr<Call>> _inFlightCalls;
+
+    /**
+     * @brief The callbacks to invoke when the pipeline is idle
+     */
+    std::vector<IdleHandler> _idleHandlers;
+
+    /**
+     * @brief Used to add the D-Bus method call into the pipeline
+     *
+     * @param[in] method - The D-Bus method call message
+     * @param[in] handler - The handler to invoke with the reply
+     * @param[in] handleCancel - Whether the handler must be invoked with
+     *                           the error if the call is cancelled.
+     *
+     * @return NULL
+     */
+    void call(sdbusplus::message::message&& method, ReplyHandler handler,
+              bool handleCancel);
+
+    /**
+     * @brief Used to send the pending D-Bus method calls as per
+     *        the allowed concurrency and invoke the idle callbacks
+     *        if nothing is pending.
+     *
+     * @return NULL
+     */
+    void dispatch();
+
+    /**
+     * @brief Used to cancel the given D-Bus method call
+     *
+     * @param[in] call - The D-Bus method call to cancel
+     *
+     * @return NULL
+     *
+     * @note The handler is invoked with the ECANCELED error only if
+     *       the call requires to handle the cancel.
+     */
+    static void cancel(Call& call);
+
+    /**
+     * @brief Used to invoke the reply handler of the given call
+     *
+     * @param[in] call - The completed D-Bus method call
+     * @param[in] reply - The reply of the D-Bus method call
+     *
+     * @return NULL
+     */
+    void complete(Call* call, sdbusplus::message::message& reply);
+
+    /**
+     * @brief Used to invoke the reply handler of the given call without
+     *        propagating the handler exception to the sd-bus.
+     *
+     * @param[in] call - The completed D-Bus method call
+     * @param[in] reply - The reply of the D-Bus method call
+     * @param[in] error - The D-Bus error if the method call is failed
+     *
+     * @return NULL
+     */
+    static void invokeHandler(Call& call, sdbusplus::message::message& reply,
+                              const sd_bus_error* error);
+
+    /**
+     * @brief The sd-bus callback to receive the D-Bus method call reply
+     */
+    static int onReply(sd_bus_message* reply, void* userData,
+                       sd_bus_error* retError);
+
+    friend class CallAwaiter;
+};
+
+/**
+ * @class CallAwaiter
+ *
+ * @brief The awaitable to use the D-Bus method call reply in the coroutine
+ *        without blocking the other D-Bus requests processing.
+ */
+class CallAwaiter
+{
+  public:
+    CallAwaiter() = delete;
+    CallAwaiter(const CallAwaiter&) = delete;
+    CallAwaiter& operator=(const CallAwaiter&) = delete;
+    CallAwaiter(CallAwaiter&&) = delete;
+    CallAwaiter& operator=(CallAwaiter&&) = delete;
+
+    /**
+     * @brief Constructor to create the awaitable for the given method call
+     *
+     * @param[in] pipeline - The pipeline to send the D-Bus method call
+     * @param[in] method - The D-Bus method call message
+     */
+    CallAwaiter(CallPipeline& pipeline, sdbusplus::message::message&& method);
+
+    ~CallAwaiter();
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle);
+
+    sdbusplus::message::message await_resume();
+
+  private:
+    /**
+     * @brief The pipeline to send the D-Bus method call
+     */
+    CallPipeline& _pipeline;
+
+    /**
+     * @brief The D-Bus method call message
+     */
+    sdbusplus::message::message _method;
+
+    /**
+     * @brief The D-Bus method call reply message
+     */
+    sdbusplus::message::message _reply;
+
+    /**
+     * @brief The D-Bus error if the method call is failed
+     */
+    sd_bus_error _error = SD_BUS_ERROR_NULL;
+};
+
+namespace details
+{
+
+/**
+ * @brief Used to keep the coroutine result until the awaiter reads it
+ */
+template <typename T>
+struct TaskResult
+{
+    std::optional<T> value;
+
+    template <typename U>
+    void return_value(U&& result)
+    {
+        value.emplace(std::forward<U>(result));
+    }
+
+    T get()
+    {
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskResult<void>
+{
+    void return_void() {}
+
+    void get() {}
+};
+
+} // namespace details
+
+/**
+ * @class Task
+ *
+ * @brief The coroutine type which is started when it is awaited and
+ *        resumes the awaiting coroutine once it is completed.
+ *
+ * @tparam T - The coroutine result type
+ *
+ * @note The exception which is thrown by the coroutine is rethrown to
+ *       the awaiting coroutine.
+ */
+template <typename T = void>
+class [[nodiscard]] Task
+{
+  public:
+    struct promise_type : details::TaskResult<T>
+    {
+        std::coroutine_handle<> continuation{std::noop_coroutine()};
+        std::exception_ptr exception;
+
+        Task get_return_object()
+        {
+            return Task{
+                std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        auto final_suspend() noexcept
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    return handle.promise().continuation;
+                }
+
+                void await_resume() const noexcept {}
+            };
+            return FinalAwaiter{};
+        }
+
+        void unhandled_exception()
+        {
+            exception = std::current_exception();
+        }
+    };
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&) = delete;
+
+    Task(Task&& task) noexcept : _handle(std::exchange(task._handle, nullptr))
+    {}
+
+    ~Task()
+    {
+        if (_handle)
+        {
+            _handle.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<>
+        await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        _handle.promise().continuation = continuation;
+        return _handle;
+    }
+
+    T await_resume()
+    {
+        if (_handle.promise().exception)
+        {
+            std::rethrow_exception(_handle.promise().exception);
+        }
+        return _handle.promise().get();
+    }
+
+  private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle)
+    {}
+
+    /**
+     * @brief The coroutine handle
+     */
+    std::coroutine_handle<promise_type> _handle;
+};
+
+namespace details
+{
+
+/**
+ * @brief The coroutine type which is started immediately and
+ *        destroyed once it is completed.
+ */
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object()
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception();
+    };
+};
+
+} // namespace details
+
+/**
+ * @brief Used to reply the given D-Bus method call with the error
+ *
+ * @param[in] methodCall - The D-Bus method call to reply
+ * @param[in] error - The error to reply
+ *
+ * @return NULL
+ */
+void replyError(sdbusplus::message::message& methodCall,
+                const sdbusplus::exception::exception& error);
+
+/**
+ * @brief Used to reply the given D-Bus method call with the internal
+ *        failure error
+ *
+ * @param[in] methodCall - The D-Bus method call to reply
+ * @param[in] what - The reason of the failure to trace
+ *
+ * @return NULL
+ */
+void replyInternalFailure(sdbusplus::message::message& methodCall,
+                          const char* what);
+
+/**
+ * @brief Used to run the given task and reply the given D-Bus method call
+ *        with the task result (deferred reply) once the task is completed.
+ *
+ * @details The D-Bus method handler can return immediately after calling
+ *          this API so, the other D-Bus requests and signals are processed
+ *          while the task is waiting for the D-Bus replies.
+ *
+ * @param[in] methodCall - The D-Bus method call to reply
+ * @param[in] task - The task which gives the method call result
+ *
+ * @return NULL
+ *
+ * @note The D-Bus method call is replied with the error if the task is
+ *       failed with the exception.
+ */
+template <typename T>
+details::Detached replyLater(sdbusplus::message::message methodCall,
+                             Task<T> task)
+{
+    try
+    {
+        auto reply = methodCall.new_method_return();
+        if constexpr (std::is_void_v<T>)
+        {
+            co_await task;
+        }
+        else
+        {
+            reply.append(co_await task);
+        }
+        reply.method_return();
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        replyError(methodCall, e);
+    }
+    catch (const std::exception& e)
+    {
+        replyInternalFailure(methodCall, e.what());
+    }
+}
+
+} // namespace dbus_async
+} // namespace hw_isolation
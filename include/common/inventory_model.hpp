@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/common_types.hpp"
+
+#include <sdbusplus/bus.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace inventory
+{
+
+using namespace hw_isolation::type;
+
+/**
+ * @brief The inventory object interfaces by using the service name
+ *        (same as the object mapper GetObject response).
+ */
+using ObjectServices = std::map<std::string, std::vector<std::string>>;
+
+/**
+ * @brief API to init the inventory model
+ *
+ * @details The whole inventory is prefetched with the bulk D-Bus calls
+ *          (object mapper GetSubTree and GetManagedObjects of the inventory
+ *          services) into the in-memory model so the inventory lookups
+ *          will be answered without the D-Bus round trips. The required
+ *          properties are kept up to date by using the PropertiesChanged
+ *          signal, and the inventory objects and interfaces are added or
+ *          removed by using the InterfacesAdded and InterfacesRemoved
+ *          signals. The model will be prefetched again when it is required
+ *          only if the inventory signal can't be applied or the inventory
+ *          service is restarted or exited.
+ *
+ * @param[in] bus - Bus to attach to.
+ *
+ * @return NULL
+ *
+ * @note The inventory lookups will fall back to the D-Bus calls if
+ *       the inventory model is not available.
+ */
+void initInventoryModel(sdbusplus::bus::bus& bus);
+
+/**
+ * @brief Used to get the given inventory object interfaces by using
+ *        the service name
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - The inventory object path
+ *
+ * @return The inventory object interfaces by using the service name
+ *         Throw exception on failure
+ */
+ObjectServices getObject(sdbusplus::bus::bus& bus,
+                         const sdbusplus::message::object_path& objPath);
+
+/**
+ * @brief Used to get child inventory path by using parent
+ *        parent inventory path with specific interface
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] parentObjPath - The parent object path to get subtrees
+ * @param[in] interfaceName - The child interface name
+ *
+ * @return The list of child inventory path on success
+ *         Empty optional on failure
+ */
+std::optional<std::vector<sdbusplus::message::object_path>>
+    getChildsInventoryPath(sdbusplus::bus::bus& bus,
+                           const sdbusplus::message::object_path& parentObjPath,
+                           const std::string& interfaceName);
+
+/**
+ * @brief Used to get the PrettyName of the given inventory object
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - The inventory object path
+ *
+ * @return The PrettyName on success
+ *         Throw exception on failure
+ */
+std::string getPrettyName(sdbusplus::bus::bus& bus,
+                          const sdbusplus::message::object_path& objPath);
+
+/**
+ * @brief Used to get the LocationCode of the given inventory object
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - The inventory object path
+ *
+ * @return The LocationCode on success
+ *         Throw exception on failure
+ */
+LocationCode getLocationCode(sdbusplus::bus::bus& bus,
+                             const sdbusplus::message::object_path& objPath);
+
+/**
+ * @brief Used to get the unexpanded format of the LocationCode of
+ *        the given inventory object
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - The inventory object path
+ *
+ * @return The unexpanded LocationCode on success
+ *         Empty optional if the LocationCode is not in the expected format
+ *         Throw exception if failed to get the LocationCode
+ *
+ * @note The unexpanded LocationCode is computed once for each inventory
+ *       object in the inventory model.
+ */
+std::optional<LocationCode>
+    getUnexpandedLocationCode(sdbusplus::bus::bus& bus,
+                              const sdbusplus::message::object_path& objPath);
+
+/**
+ * @brief Used to get the OperationalStatus Functional of the given
+ *        inventory object
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - The inventory object path
+ *
+ * @return The Functional on success
+ *         Throw exception on failure
+ */
+bool isFunctional(sdbusplus::bus::bus& bus,
+                  const sdbusplus::message::object_path& objPath);
+
+} // namespace inventory
+} // namespace hw_isolation
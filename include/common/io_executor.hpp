@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <sdeventplus/event.hpp>
+
+#include <functional>
+
+namespace hw_isolation
+{
+namespace io
+{
+
+/**
+ * @brief The job to run in the I/O worker thread
+ *
+ * @note The job must not use the D-Bus objects and the other state that is
+ *       used by the sd_event loop thread.
+ */
+using Job = std::function<void()>;
+
+/**
+ * @brief The callback to invoke in the sd_event loop thread once
+ *        the job is completed.
+ */
+using Completion = std::function<void()>;
+
+/**
+ * @brief API to init the I/O executor
+ *
+ * @details The I/O executor runs the submitted jobs (for example, file
+ *          writes) in the single worker thread in the submitted order so,
+ *          the slow file I/O won't block the D-Bus requests processing,
+ *          and the job completion is notified to the sd_event loop by
+ *          using the eventfd.
+ *
+ * @param[in] eventLoop - The event loop to invoke the job completion
+ *
+ * @return NULL on success
+ *         Throw exception on failure
+ *
+ * @note The jobs are run immediately in the caller thread if the executor
+ *       is not initialized.
+ */
+void initExecutor(const sdeventplus::Event& eventLoop);
+
+/**
+ * @brief Used to run the pending jobs and stop the worker thread
+ *
+ * @return NULL
+ *
+ * @note The completion of the pending jobs won't be invoked.
+ */
+void shutdownExecutor();
+
+/**
+ * @brief Used to submit the job to run in the worker thread
+ *
+ * @param[in] job - The job to run
+ * @param[in] completion - The callback to invoke in the sd_event loop
+ *                         thread once the job is completed. Optional.
+ *
+ * @return NULL
+ *
+ * @note The jobs are run in the submitted order, and the completion is
+ *       invoked even if the job is failed with the exception.
+ */
+void submit(Job job, Completion completion = nullptr);
+
+} // namespace io
+} // namespace hw_isolation
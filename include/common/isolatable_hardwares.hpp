@@ -7,6 +7,7 @@
 
 #include <map>
 #include <optional>
+#include <string_view>
 
 namespace hw_isolation
 {
@@ -38,9 +39,9 @@ using IsItIsoHwInvPath = bool;
 // type::LocationCode and PrettyName are string type.
 using UniqueHwId = std::variant<type::InstanceId, std::string>;
 
-using LookupFuncForInvPath = std::function<IsItIsoHwInvPath(
+using LookupFuncForInvPath = IsItIsoHwInvPath (*)(
     sdbusplus::bus::bus&, const sdbusplus::message::object_path&,
-    const UniqueHwId&)>;
+    const UniqueHwId&);
 
 IsItIsoHwInvPath itemInstanceId(sdbusplus::bus::bus& bus,
                                 const sdbusplus::message::object_path& objPath,
@@ -62,6 +63,24 @@ namespace isolatable_hws
 
 using namespace hw_isolation::type;
 
+/**
+ * @brief API to init the isolatable hardwares path cache
+ *
+ * @details The phal cec device tree targets, the inventory object paths and
+ *          the physical paths which are resolved by IsolatableHWs are
+ *          cached in one module level cache which is shared by all
+ *          IsolatableHWs users, and the cached inventory object paths are
+ *          invalidated by using the inventory change watchers.
+ *
+ * @param[in] bus - Bus to attach to.
+ *
+ * @return NULL
+ *
+ * @note The inventory object paths are not cached if the inventory
+ *       change watchers are failed to add or this is not called.
+ */
+void initPathCache(sdbusplus::bus::bus& bus);
+
 /**
  * @class IsolatableHWs
  *
@@ -79,7 +98,9 @@ class IsolatableHWs
     ~IsolatableHWs() = default;
 
     /**
-     * @brief Constructor to initialize isolatable hardware list
+     * @brief Constructor
+     *
+     * @note The isolatable hardware list is defined at compile time.
      */
     IsolatableHWs(sdbusplus::bus::bus& bus);
 
@@ -103,8 +124,9 @@ class IsolatableHWs
              */
             struct ItemInterfaceName
             {
-                std::string _name;
-                explicit ItemInterfaceName(const std::string& ifaceName) :
+                std::string_view _name;
+                constexpr explicit ItemInterfaceName(
+                    std::string_view ifaceName) :
                     _name(ifaceName)
                 {}
             };
@@ -118,8 +140,9 @@ class IsolatableHWs
              */
             struct PhalPdbgClassName
             {
-                std::string _name;
-                explicit PhalPdbgClassName(const std::string& pClassName) :
+                std::string_view _name;
+                constexpr explicit PhalPdbgClassName(
+                    std::string_view pClassName) :
                     _name(pClassName)
                 {}
             };
@@ -129,20 +152,27 @@ class IsolatableHWs
 
             HwId() = delete;
 
-            HwId(ItemInterfaceName ifaceName, PhalPdbgClassName pClassName) :
-                _interfaceName(ifaceName), _pdbgClassName(pClassName)
+            /**
+             * @note The names are not owned so, the HwId which is created
+             *       by using the runtime names should not outlive those.
+             */
+            constexpr HwId(ItemInterfaceName ifaceName,
+                           PhalPdbgClassName pClassName) :
+                _interfaceName(ifaceName),
+                _pdbgClassName(pClassName)
             {}
 
-            HwId(const std::string& ifaceName, const std::string& pClassName) :
+            constexpr HwId(std::string_view ifaceName,
+                           std::string_view pClassName) :
                 _interfaceName(ItemInterfaceName(ifaceName)),
                 _pdbgClassName(PhalPdbgClassName(pClassName))
             {}
 
-            explicit HwId(ItemInterfaceName ifaceName) :
+            constexpr explicit HwId(ItemInterfaceName ifaceName) :
                 _interfaceName(ifaceName), _pdbgClassName("")
             {}
 
-            explicit HwId(PhalPdbgClassName pClassName) :
+            constexpr explicit HwId(PhalPdbgClassName pClassName) :
                 _interfaceName(""), _pdbgClassName(pClassName)
             {}
 
@@ -151,7 +181,7 @@ class IsolatableHWs
              *        being equal if the other names are empty, so that
              *        one can look up a HwId with just one of the Name.
              */
-            bool operator==(const HwId& hwId) const
+            constexpr bool operator==(const HwId& hwId) const
             {
                 if (!hwId._interfaceName._name.empty())
                 {
@@ -165,31 +195,19 @@ class IsolatableHWs
 
                 return false;
             }
-
-            /**
-             * @brief A < operator is required to stl_function.h to insert
-             *        in STL based on some order.
-             *
-             *        Using PhalPdbgClassName since most of lookup will happen
-             *        by using PhalPdbgClassName key.
-             */
-            bool operator<(const HwId& hwId) const
-            {
-                return hwId._pdbgClassName._name < _pdbgClassName._name;
-            }
         };
 
         bool _isItFRU;
         HwId _parentFruHwId;
         devtree::lookup_func::LookupFuncForPhysPath _physPathFuncLookUp;
         inv_path_lookup_func::LookupFuncForInvPath _invPathFuncLookUp;
-        std::string _prettyName;
+        std::string_view _prettyName;
 
-        HW_Details(
+        constexpr HW_Details(
             bool isItFRU, const HwId& parentFruHwId,
             devtree::lookup_func::LookupFuncForPhysPath physPathFuncLookUp,
             inv_path_lookup_func::LookupFuncForInvPath invPathFuncLookUp,
-            const std::string& prettyName) :
+            std::string_view prettyName) :
             _isItFRU(isItFRU),
             _parentFruHwId(parentFruHwId),
             _physPathFuncLookUp(physPathFuncLookUp),
@@ -217,6 +235,9 @@ class IsolatableHWs
      *
      * @return The isolated hardware inventory path on success
      *         Empty optional on failure
+     *
+     * @note The persisted inventory path is returned without the lookup
+     *       during the warm start (please refer resolution_cache).
      */
     std::optional<sdbusplus::message::object_path>
         getInventoryPath(const devtree::DevTreePhysPath& physicalPath,
@@ -228,11 +249,6 @@ class IsolatableHWs
      */
     sdbusplus::bus::bus& _bus;
 
-    /**
-     * @brief The list of isolatable hardwares
-     */
-    std::multimap<HW_Details::HwId, HW_Details> _isolatableHWsList;
-
     /**
      * @brief Get the HwID based on given ItemInterfaceName or
      *        PhalPdbgClassName.
@@ -256,7 +272,7 @@ class IsolatableHWs
      *         or an empty optional if not found.
      */
     std::optional<std::pair<HW_Details::HwId, HW_Details>>
-        getIsolatableHWDetailsByPrettyName(const std::string& prettyName) const;
+        getIsolatableHWDetailsByPrettyName(std::string_view prettyName) const;
 
     /**
      * @brief Get the HwID based on the given D-Bus object path.
@@ -309,6 +325,21 @@ class IsolatableHWs
     std::optional<std::vector<sdbusplus::message::object_path>>
         getInventoryPathsByLocCode(const LocationCode& unexpandedLocCode);
 
+    /**
+     * @brief Used to look up the inventory path of isolated hardware
+     *        by using the phal cec device tree and the inventory
+     *
+     * @param[in] physicalPath - The physical path of isolated hardware
+     * @param[in|out] persistedCoreEcoMode - Used to indicate or get the core
+     *                                       eco mode.
+     *
+     * @return The isolated hardware inventory path on success
+     *         Empty optional on failure
+     */
+    std::optional<sdbusplus::message::object_path>
+        lookupInventoryPath(const devtree::DevTreePhysPath& physicalPath,
+                            bool& persistedCoreEcoMode);
+
     /**
      * @brief Used to get the parent fru phal cec device tree target
      *        by using isolated phal cec device tree target
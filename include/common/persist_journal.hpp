@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cereal/archives/binary.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace journal
+{
+
+/**
+ * @brief The kind of the persisted objects
+ *
+ * @note The values are stored in the journal so, must not be changed.
+ */
+enum class ObjectKind : uint8_t
+{
+    Entry = 1,
+    Event = 2,
+    EcoCores = 3,
+    ResolutionCache = 4
+};
+
+using ObjectId = uint32_t;
+
+// The directory which contains the journal and the separate files which
+// were used to persist the objects by the older version.
+constexpr auto PERSIST_DATA_DIR = "/var/lib/op-hw-isolation/persistdata";
+
+/**
+ * @brief API to init the persistence journal
+ *
+ * @details All the persisted objects (hardware isolation entries, hardware
+ *          status events, ECO cores and the inventory path resolution
+ *          cache) are kept in the single append-only journal file that
+ *          starts with the versioned header, and each object change is
+ *          appended as the small checksummed record. The journal is read
+ *          sequentially only once to replay into the in-memory objects,
+ *          and it is compacted (rewritten with only the live objects) when
+ *          the stale records are more than the live objects.
+ *
+ * @param[in] persistDataDir - The directory to keep the journal
+ *
+ * @return NULL
+ *
+ * @note The objects which are persisted in the separate files by the older
+ *       version are imported into the journal if the journal is not exist.
+ *       The journal is read and written in the caller thread only while
+ *       initializing so, this should be called before persisting any
+ *       object. The closed journal is initialized again with the given
+ *       directory (for example, by the unit tests).
+ */
+void initJournal(
+    const std::filesystem::path& persistDataDir = PERSIST_DATA_DIR);
+
+/**
+ * @brief API to stop persisting the object changes at the daemon exit
+ *
+ * @details The D-Bus objects are destroyed at the exit, and their persisted
+ *          objects must not be removed so, all the object changes after
+ *          closing the journal are ignored.
+ *
+ * @return NULL
+ *
+ * @note The journal writes which are queued before closing are written
+ *       by the I/O executor so, the I/O executor should be shut down after
+ *       closing the journal to complete them.
+ */
+void closeJournal();
+
+/**
+ * @brief Used to persist the given object payload
+ *
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ * @param[in] payload - The serialized object
+ *
+ * @return NULL
+ *
+ * @note The in-memory object is updated immediately and the journal is
+ *       written later by the I/O executor (write-behind) so, the failure
+ *       is just traced. Nothing is appended if the given payload is same
+ *       as the persisted payload.
+ */
+void put(ObjectKind kind, ObjectId id, std::string&& payload);
+
+/**
+ * @brief Used to get the persisted object payload
+ *
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ *
+ * @return The serialized object if persisted
+ *         nullptr otherwise
+ *
+ * @note The returned payload is valid until the next journal change.
+ */
+const std::string* get(ObjectKind kind, ObjectId id);
+
+/**
+ * @brief Used to remove the persisted object
+ *
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ *
+ * @return NULL
+ *
+ * @note Same as put(), the journal is written later by the I/O executor.
+ */
+void erase(ObjectKind kind, ObjectId id);
+
+/**
+ * @brief Used to get the id of the persisted objects of the given kind
+ *
+ * @param[in] kind - The object kind
+ *
+ * @return The object ids in the ascending order
+ */
+std::vector<ObjectId> getIds(ObjectKind kind);
+
+/**
+ * @brief Used to serialize and persist the given object
+ *
+ * @tparam T - The object type which is supported by Cereal
+ *
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ * @param[in] object - The object to persist
+ *
+ * @return NULL on success
+ *         Throw cereal exception on failure
+ */
+template <class T>
+void save(ObjectKind kind, ObjectId id, const T& object)
+{
+    std::ostringstream os(std::ios::binary);
+    {
+        cereal::BinaryOutputArchive oarchive(os);
+        oarchive(object);
+    }
+    put(kind, id, std::move(os).str());
+}
+
+/**
+ * @brief Used to deserialize the given object from the persisted payload
+ *
+ * @tparam T - The object type which is supported by Cereal
+ *
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ * @param[out] object - The object to deserialize into
+ *
+ * @return true if the object is deserialized
+ *         false if the object is not persisted
+ *         Throw cereal exception on failure
+ */
+template <class T>
+bool load(ObjectKind kind, ObjectId id, T& object)
+{
+    auto payload = get(kind, id);
+    if (payload == nullptr)
+    {
+        return false;
+    }
+
+    // The payload is copied since the object might be persisted again
+    // while loading.
+    std::istringstream is(*payload, std::ios::binary);
+    cereal::BinaryInputArchive iarchive(is);
+    iarchive(object);
+    return true;
+}
+
+} // namespace journal
+} // namespace hw_isolation
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "attributes_info.H"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace hw_isolation
+{
+namespace devtree
+{
+
+/**
+ * @brief The offset and length of the required property value in the
+ *        phal cec device tree blob.
+ */
+struct PropOffset
+{
+    uint32_t offset{0};
+    uint32_t length{0};
+};
+
+/**
+ * @brief The required properties offset of the phal cec device tree node.
+ */
+struct NodePropsOffset
+{
+    PropOffset hwasState;
+    PropOffset physBinPath;
+};
+
+/**
+ * @class DevTreeBlob
+ *
+ * @brief Used to read the required attributes of the phal cec device tree
+ *        targets directly from the phal cec device tree blob.
+ *
+ * @details The phal cec device tree blob is mapped as read only and
+ *          the offsets of the required properties are indexed by using
+ *          the device tree node path (which is same as pdbg_target_path)
+ *          while loading so, the bulk reads are not required to go through
+ *          the pdbg target attribute API.
+ *
+ * @note The users must fall back to the pdbg target attribute API if
+ *       the required property is not found since the phal cec device tree
+ *       blob might not be loaded.
+ */
+class DevTreeBlob
+{
+  public:
+    DevTreeBlob() = delete;
+    DevTreeBlob(const DevTreeBlob&) = delete;
+    DevTreeBlob& operator=(const DevTreeBlob&) = delete;
+    DevTreeBlob(DevTreeBlob&&) = delete;
+    DevTreeBlob& operator=(DevTreeBlob&&) = delete;
+
+    /**
+     * @brief Constructor to load the given phal cec device tree blob.
+     *
+     * @param[in] devTreePath - The phal cec device tree blob path
+     */
+    explicit DevTreeBlob(const std::filesystem::path& devTreePath);
+
+    /** @brief Unmap the phal cec device tree blob */
+    ~DevTreeBlob();
+
+    /**
+     * @brief Used to get ATTR_HWAS_STATE of the given device tree node
+     *
+     * @param[in] nodePath - The device tree node path
+     * @param[out] hwasState - The ATTR_HWAS_STATE value
+     *
+     * @return true on success
+     *         false if the property is not found or invalid
+     *
+     * @note Only the deconfiguredByEid, poweredOn, present and functional
+     *       members are decoded and others are default initialized.
+     */
+    bool getHwasState(std::string_view nodePath,
+                      ATTR_HWAS_STATE_Type& hwasState) const;
+
+    /**
+     * @brief Used to get ATTR_PHYS_BIN_PATH of the given device tree node
+     *
+     * @param[in] nodePath - The device tree node path
+     * @param[out] physBinPath - The ATTR_PHYS_BIN_PATH value
+     *
+     * @return true on success
+     *         false if the property is not found or invalid
+     */
+    bool getPhysBinPath(std::string_view nodePath,
+                        ATTR_PHYS_BIN_PATH_Type& physBinPath) const;
+
+  private:
+    /**
+     * @brief The mapped phal cec device tree blob
+     */
+    const uint8_t* _blob{nullptr};
+
+    /**
+     * @brief The mapped phal cec device tree blob size
+     */
+    size_t _blobSize{0};
+
+    /**
+     * @brief The required properties offset by using the device tree
+     *        node path.
+     */
+    std::map<std::string, NodePropsOffset, std::less<>> _nodesPropsOffset;
+
+    /**
+     * @brief Used to index the required properties offset from the
+     *        mapped phal cec device tree blob.
+     *
+     * @return true on success
+     *         false if the phal cec device tree blob is invalid
+     */
+    bool indexNodesPropsOffset();
+
+    /**
+     * @brief Used to get the required property offset of the given node
+     *
+     * @param[in] nodePath - The device tree node path
+     * @param[in] prop - The member of the required property offset
+     *
+     * @return The property offset if found
+     *         nullptr if not found
+     */
+    const PropOffset* getPropOffset(std::string_view nodePath,
+                                    PropOffset NodePropsOffset::*prop) const;
+};
+
+} // namespace devtree
+} // namespace hw_isolation
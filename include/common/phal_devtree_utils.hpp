@@ -7,12 +7,19 @@ extern "C"
 #include <libpdbg.h>
 }
 
+#include "attributes_info.H"
+
 #include "common/common_types.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
 
+#include <algorithm>
+#include <array>
+#include <compare>
 #include <functional>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace hw_isolation
 {
@@ -20,15 +27,235 @@ namespace devtree
 {
 
 using namespace hw_isolation::type;
-using DevTreePhysPath = std::vector<uint8_t>;
+using DevTreeGeneration = uint32_t;
+using DevTreeDigest = uint64_t;
+
+/**
+ * @class DevTreePhysPath
+ *
+ * @brief The phal cec device tree physical path (which is same as
+ *        the libguard EntityPath raw data) that is stored inline with
+ *        the fixed capacity to avoid the heap allocation.
+ *
+ * @note The unused bytes are always zero so the equality and hash are
+ *       computed by using the whole fixed capacity.
+ */
+class DevTreePhysPath
+{
+  public:
+    using value_type = uint8_t;
+    using const_iterator = const uint8_t*;
+
+    /**
+     * @brief The maximum size of the physical path
+     */
+    static constexpr size_t maxSize = sizeof(ATTR_PHYS_BIN_PATH_Type);
+
+    DevTreePhysPath() = default;
+
+    /**
+     * @brief Constructor to create the physical path from the given
+     *        raw data.
+     *
+     * @param[in] first - The beginning of the raw data
+     * @param[in] last - The end of the raw data
+     *
+     * @note Throw exception if the given raw data size is more than
+     *       the maximum size.
+     */
+    DevTreePhysPath(const uint8_t* first, const uint8_t* last)
+    {
+        auto size = static_cast<size_t>(last - first);
+        if (size > maxSize)
+        {
+            throw std::length_error("The given physical path size is more "
+                                    "than the maximum size");
+        }
+        std::copy(first, last, _data.begin());
+        _size = size;
+    }
+
+    const uint8_t* data() const
+    {
+        return _data.data();
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return _data.data();
+    }
+
+    const_iterator end() const
+    {
+        return _data.data() + _size;
+    }
+
+    /**
+     * @brief Used to append the given value in the physical path
+     *
+     * @param[in] value - The value to append
+     *
+     * @note Throw exception if the physical path is full.
+     */
+    void push_back(uint8_t value)
+    {
+        if (_size == maxSize)
+        {
+            throw std::length_error("The physical path is full");
+        }
+        _data[_size++] = value;
+    }
+
+    /**
+     * @brief Used to resize the physical path with the zero value
+     *
+     * @param[in] size - The new size of the physical path
+     *
+     * @note Throw exception if the given size is more than the maximum size.
+     */
+    void resize(size_t size)
+    {
+        if (size > maxSize)
+        {
+            throw std::length_error("The given physical path size is more "
+                                    "than the maximum size");
+        }
+        std::fill(_data.begin() + std::min(size, _size), _data.end(), 0);
+        _size = size;
+    }
+
+    bool operator==(const DevTreePhysPath& physPath) const
+    {
+        return (_size == physPath._size) && (_data == physPath._data);
+    }
+
+    std::strong_ordering operator<=>(const DevTreePhysPath& physPath) const
+    {
+        return std::lexicographical_compare_three_way(
+            begin(), end(), physPath.begin(), physPath.end());
+    }
+
+    /**
+     * @brief The hash function (FNV-1a) of the physical path
+     */
+    struct Hash
+    {
+        size_t operator()(const DevTreePhysPath& physPath) const noexcept
+        {
+            uint32_t hash{2166136261U};
+            for (const auto& byte : physPath._data)
+            {
+                hash = (hash ^ byte) * 16777619U;
+            }
+            return (hash ^ physPath._size) * 16777619U;
+        }
+    };
+
+    /**
+     * @brief Helper template that is required by Cereal to perform
+     *        serialization.
+     *
+     * @details The physical path is serialized as the raw data vector
+     *          to keep the persisted data format.
+     *
+     * @tparam Archive    - Cereal archive type.
+     * @param[in] archive - Reference to Cereal archive.
+     *
+     * @return NULL
+     */
+    template <class Archive>
+    void save(Archive& archive) const
+    {
+        std::vector<uint8_t> rawData(begin(), end());
+        archive(rawData);
+    }
+
+    /**
+     * @brief Helper template that is required by Cereal to perform
+     *        deserialization.
+     *
+     * @tparam Archive    - Cereal archive type.
+     * @param[in] archive - Reference to Cereal archive.
+     *
+     * @return NULL
+     */
+    template <class Archive>
+    void load(Archive& archive)
+    {
+        std::vector<uint8_t> rawData;
+        archive(rawData);
+        *this =
+            DevTreePhysPath(rawData.data(), rawData.data() + rawData.size());
+    }
+
+  private:
+    /**
+     * @brief The physical path raw data
+     */
+    std::array<uint8_t, maxSize> _data{};
+
+    /**
+     * @brief The physical path size
+     */
+    size_t _size{0};
+};
 
 /**
  * @brief API to init PHAL (POWER Hardware Abstraction Layer)
  *
- * @details PHAL should init to use phal cec device tree
+ * @details PHAL should init to use phal cec device tree and the cec device
+ *          tree targets will be indexed by their physical path to look up
+ *          the isolated hardware target without traversing the whole tree.
  */
 void initPHAL();
 
+/**
+ * @brief API to reinit PHAL (POWER Hardware Abstraction Layer)
+ *
+ * @details The phal cec device tree might be replaced (for example, code
+ *          update and phal-reinit-devtree) so, PHAL should reinit to use
+ *          the changed phal cec device tree, and all phal cec device tree
+ *          targets which are got before reinit should not be used.
+ *
+ * @return NULL on success
+ *         Throw exception on failure
+ */
+void reinitPHAL();
+
+/**
+ * @brief Used to get the phal cec device tree generation
+ *
+ * @details The generation will be changed whenever the phal cec device
+ *          tree is initialized so, the users can use it to invalidate
+ *          the data that are derived from the phal cec device tree.
+ *
+ * @return The phal cec device tree generation
+ */
+DevTreeGeneration getDevTreeGeneration();
+
+/**
+ * @brief Used to get the digest of the phal cec device tree
+ *
+ * @details The digest (FNV-1a) of the phal cec device tree blob is computed
+ *          whenever the phal cec device tree is initialized so, the users
+ *          can use it to check whether the persisted data that are derived
+ *          from the phal cec device tree are still valid.
+ *
+ * @return The phal cec device tree digest
+ *         Empty optional if failed to read the phal cec device tree blob
+ */
+std::optional<DevTreeDigest> getDevTreeDigest();
+
 /**
  * @brief Get unexpanded location code
  *
@@ -113,6 +340,31 @@ DevTreePhysPath
  */
 bool isECOcore(struct pdbg_target* coreTgt);
 
+/**
+ * @brief Used to refresh the phal cec device tree attributes snapshot
+ *
+ * @details The frequently used attributes (HWAS_STATE, MRU_ID,
+ *          CHIP_UNIT_POS, CHIPLET_ID, LOCATION_CODE and ECO_MODE) are read
+ *          only once per the snapshot generation, so this API should be
+ *          called to start the new generation before processing the cec
+ *          device tree attributes that might be updated by the host.
+ *
+ * @return NULL
+ */
+void refreshAttrSnapshot();
+
+/**
+ * @brief Used to get the HWAS_STATE of the given target from the phal cec
+ *        device tree attributes snapshot
+ *
+ * @param[in] target - The target to get the HWAS_STATE
+ * @param[out] hwasState - The HWAS_STATE of the given target
+ *
+ * @return true on success
+ *         false if failed to get the HWAS_STATE
+ */
+bool getHwasState(struct pdbg_target* target, ATTR_HWAS_STATE_Type& hwasState);
+
 /**
  * @brief Used to add functions that will use to get to know
  *        whether the given target (aka device tree node) can
@@ -139,8 +391,8 @@ using CanGetPhysPath = bool;
  * @note All lookup functions which are added in this namespace should
  *       match with below signature.
  */
-using LookupFuncForPhysPath = std::function<CanGetPhysPath(
-    struct pdbg_target*, InstanceId, LocationCode)>;
+using LookupFuncForPhysPath = CanGetPhysPath (*)(struct pdbg_target*,
+                                                InstanceId, LocationCode);
 
 CanGetPhysPath mruId(struct pdbg_target* pdbgTgt, InstanceId instanceId,
                      LocationCode locCode);
@@ -155,5 +407,58 @@ CanGetPhysPath pdbgIndex(struct pdbg_target* pdbgTgt, InstanceId instanceId,
                          LocationCode locCode);
 
 } // namespace lookup_func
+
+/**
+ * @brief Used to get all the phal cec device tree targets by using the given
+ *        pdbg class, location code and instance id
+ *
+ * @param[in] pdbgClass - The pdbg class name of the targets
+ * @param[in] instanceId - The instance id of the targets
+ * @param[in] locCode - The unexpanded location code of the targets
+ * @param[in] lookupFunc - The lookup function that is used to match
+ *                         the targets with given instance id and
+ *                         location code
+ * @param[in] parentTgt - The parent target to get the targets under it.
+ *                        By default, get from the whole cec device tree.
+ *
+ * @return The matched phal cec device tree targets in the pdbg class
+ *         targets traversal order
+ *         Empty list if not found
+ *
+ * @note The targets are indexed for the known lookup functions to get
+ *       the targets without traversing all targets of the given pdbg class.
+ */
+std::vector<struct pdbg_target*>
+    getTgtsByInstId(const std::string& pdbgClass, const InstanceId instanceId,
+                    const LocationCode& locCode,
+                    lookup_func::LookupFuncForPhysPath lookupFunc,
+                    struct pdbg_target* parentTgt = nullptr);
+
+/**
+ * @brief Used to get the phal cec device tree target by using the given
+ *        pdbg class, location code and instance id
+ *
+ * @param[in] pdbgClass - The pdbg class name of the target
+ * @param[in] instanceId - The instance id of the target
+ * @param[in] locCode - The unexpanded location code of the target
+ * @param[in] lookupFunc - The lookup function that is used to match
+ *                         the target with given instance id and
+ *                         location code
+ * @param[in] parentTgt - The parent target to get the target under it.
+ *                        By default, get from the whole cec device tree.
+ *
+ * @return The first matched phal cec device tree target in the pdbg class
+ *         targets traversal order on success
+ *         Empty optional if not found
+ *
+ * @note The targets are indexed for the known lookup functions to get
+ *       the target without traversing all targets of the given pdbg class.
+ */
+std::optional<struct pdbg_target*>
+    getTgtByInstId(const std::string& pdbgClass, const InstanceId instanceId,
+                   const LocationCode& locCode,
+                   lookup_func::LookupFuncForPhysPath lookupFunc,
+                   struct pdbg_target* parentTgt = nullptr);
+
 } // namespace  devtree
 } // namespace hw_isolation
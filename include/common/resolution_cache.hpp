@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/phal_devtree_utils.hpp"
+
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace hw_isolation
+{
+namespace resolution_cache
+{
+
+/**
+ * @brief The key of the resolved inventory path i.e. (the isolated hardware
+ *        physical path, whether the core is requested in the ECO mode).
+ */
+using ResolutionKey = std::pair<devtree::DevTreePhysPath, bool>;
+
+/**
+ * @brief The resolved inventory path of the isolated hardware
+ */
+struct Resolution
+{
+    std::string inventoryPath;
+
+    /**
+     * @brief Whether the core is resolved in the ECO mode
+     */
+    bool ecoCore{false};
+
+    bool operator==(const Resolution&) const = default;
+
+    /**
+     * @brief Helper template that is required by Cereal to perform
+     *        serialization and deserialization.
+     *
+     * @tparam Archive    - Cereal archive type.
+     * @param[in] archive - Reference to Cereal archive.
+     *
+     * @return NULL
+     */
+    template <class Archive>
+    void serialize(Archive& archive)
+    {
+        archive(inventoryPath, ecoCore);
+    }
+};
+
+/**
+ * @brief API to init the warm-start resolution cache
+ *
+ * @details The resolved inventory path of the isolated hardware (which
+ *          requires the phal cec device tree and the inventory lookups)
+ *          is persisted with the phal cec device tree digest and the BMC
+ *          boot id (the persisted inventory generation) so, the restored
+ *          records can use the persisted inventory path without the lookups
+ *          if the daemon is restarted in the same BMC boot with the same
+ *          phal cec device tree. The persisted inventory paths are served
+ *          only during the warm start, and the users must confirm the served
+ *          inventory paths with the live lookups in the background.
+ *
+ * @return NULL
+ *
+ * @note The persistence journal and PHAL must be initialized before this.
+ */
+void initResolutionCache();
+
+/**
+ * @brief Used to get the persisted inventory path that is not yet confirmed
+ *        by the live lookup
+ *
+ * @param[in] key - The resolution key
+ *
+ * @return The persisted resolution during the warm start
+ *         Empty optional if not found or not in the warm start
+ *
+ * @note The returned resolution is kept to confirm later by using
+ *       takeServed().
+ */
+std::optional<Resolution> getUnconfirmed(const ResolutionKey& key);
+
+/**
+ * @brief Used to update the live lookup result of the given key
+ *
+ * @param[in] key - The resolution key
+ * @param[in] resolution - The resolved inventory path, empty optional if
+ *                         failed to resolve.
+ *
+ * @return NULL
+ */
+void update(const ResolutionKey& key,
+            const std::optional<Resolution>& resolution);
+
+/**
+ * @brief Used to take one of the served resolutions to confirm
+ *
+ * @return The served resolution and its key
+ *         Empty optional if nothing to confirm
+ *
+ * @note The taken key won't be served again so, the caller must use
+ *       the live lookup to confirm it.
+ */
+std::optional<std::pair<ResolutionKey, Resolution>> takeServed();
+
+/**
+ * @brief Used to end the warm start once all the served resolutions
+ *        are confirmed.
+ *
+ * @return NULL
+ *
+ * @note The persisted resolutions that are not used in the warm start are
+ *       dropped since those are not confirmed.
+ */
+void endWarmStart();
+
+/**
+ * @brief Used to drop the resolutions of the given inventory object since
+ *        it is changed in the inventory.
+ *
+ * @param[in] inventoryObjPath - The changed inventory object path
+ *
+ * @return NULL
+ *
+ * @note The resolutions which inventory path is the given object or its
+ *       child object (for example, the parent FRU of the resolved hardware
+ *       is changed) are dropped.
+ *
+ * @note The served resolutions are still kept to confirm, and the persisted
+ *       resolutions are not updated during the warm start since those are
+ *       persisted once the served resolutions are confirmed.
+ */
+void invalidate(const std::string& inventoryObjPath);
+
+/**
+ * @brief Used to persist the resolutions if changed
+ *
+ * @return NULL
+ */
+void persist();
+
+} // namespace resolution_cache
+} // namespace hw_isolation
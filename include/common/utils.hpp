@@ -3,6 +3,7 @@
 #pragma once
 
 #include "common_types.hpp"
+#include "dbus_async.hpp"
 
 #include <fmt/format.h>
 
@@ -32,11 +33,64 @@ void initExternalModules();
  *
  * @return the service name as string on success
  *         throw exception on failure.
+ *
+ * @note The service name is cached by using the given object path and
+ *       interface, and the cached service name is dropped if the service
+ *       owner is changed (NameOwnerChanged) or the interface is removed
+ *       (InterfacesRemoved).
  */
 std::string getDBusServiceName(sdbusplus::bus::bus& bus,
                                const std::string& objPath,
                                const std::string& interface);
 
+/**
+ * @brief The handler to receive the Dbus service name
+ *
+ * @param[in] serviceName - The service name
+ *                          Empty optional on failure
+ * @param[in] error - The D-Bus error if failed to get the service name
+ *                    from the object mapper, nullptr otherwise
+ */
+using ServiceNameHandler = std::function<void(
+    const std::optional<std::string>& serviceName, const sd_bus_error* error)>;
+
+/**
+ * @brief Get the Dbus service name without blocking the other D-Bus
+ *        requests processing
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - Dbus object path.
+ * @param[in] interface - Dbus interface name.
+ * @param[in] handler - The handler to invoke with the service name
+ *
+ * @return NULL
+ *
+ * @note The handler is invoked immediately if the service name is cached
+ *       else, the object mapper is called through the given pipeline.
+ */
+void getDBusServiceName(dbus_async::CallPipeline& pipeline,
+                        sdbusplus::bus::bus& bus, const std::string& objPath,
+                        const std::string& interface,
+                        ServiceNameHandler handler);
+
+/**
+ * @brief Get the Dbus service name without blocking the other D-Bus
+ *        requests processing
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - Dbus object path.
+ * @param[in] interface - Dbus interface name.
+ *
+ * @return The task which gives the service name on success
+ *         throw exception on failure.
+ */
+dbus_async::Task<std::string>
+    getDBusServiceName(dbus_async::CallPipeline& pipeline,
+                       sdbusplus::bus::bus& bus, std::string objPath,
+                       std::string interface);
+
 /**
  * @brief Get the given dbus property value
  *
@@ -97,6 +151,66 @@ T getDBusPropertyVal(sdbusplus::bus::bus& bus, const std::string& objPath,
     return propertyVal;
 }
 
+/**
+ * @brief Get the given dbus property value without blocking the other
+ *        D-Bus requests processing
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - Dbus object path.
+ * @param[in] propInterface - Interface name of property.
+ * @param[in] propName - Name of property to get value.
+ *
+ * @return The task which gives the dbus property value as T type on success
+ *         throw exception on failure.
+ *
+ * @note The caller must take care the value validation
+ *       i.e the given value is empty or not.
+ */
+template <typename T>
+dbus_async::Task<T> getDBusPropertyVal(dbus_async::CallPipeline& pipeline,
+                                       sdbusplus::bus::bus& bus,
+                                       std::string objPath,
+                                       std::string propInterface,
+                                       std::string propName)
+{
+    try
+    {
+        auto dbusServiceName = co_await getDBusServiceName(
+            pipeline, bus, objPath, propInterface);
+
+        auto method =
+            bus.new_method_call(dbusServiceName.c_str(), objPath.c_str(),
+                                "org.freedesktop.DBus.Properties", "Get");
+
+        method.append(propInterface, propName);
+
+        auto reply = co_await pipeline.awaitCall(std::move(method));
+
+        std::variant<T> resp;
+        reply.read(resp);
+        co_return std::get<T>(resp);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] to get the given dbus property "
+                        "[{}] interface [{}] for object path [{}]",
+                        e.what(), propName, propInterface, objPath)
+                .c_str());
+        throw;
+    }
+    catch (const std::bad_variant_access& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] to get the given dbus property "
+                        "[{}] interface [{}] for object path [{}]",
+                        e.what(), propName, propInterface, objPath)
+                .c_str());
+        throw;
+    }
+}
+
 /**
  * @brief Set the given dbus property value
  *
@@ -160,6 +274,21 @@ void isHwDeisolationAllowed(sdbusplus::bus::bus& bus);
  */
 bool isHwIosolationSettingEnabled(sdbusplus::bus::bus& bus);
 
+/**
+ * @brief Used to get to know whether hardware isolation setting is
+ *        enabled or not without blocking the other D-Bus requests
+ *        processing
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ *
+ * @return The task which gives the hardware isolation setting on success
+ *         true to allow the hardware isolation feature on failure
+ */
+dbus_async::Task<bool>
+    isHwIosolationSettingEnabled(dbus_async::CallPipeline& pipeline,
+                                 sdbusplus::bus::bus& bus);
+
 /**
  * @brief Used to set the Enabled property value by using the given
  *        dbus object path
@@ -178,6 +307,45 @@ bool isHwIosolationSettingEnabled(sdbusplus::bus::bus& bus);
 void setEnabledProperty(sdbusplus::bus::bus& bus,
                         const std::string& dbusObjPath, bool enabledPropVal);
 
+/**
+ * @brief Used to set the Enabled property value by using the given
+ *        dbus object path without waiting for the D-Bus reply
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] dbusObjPath - The object path to set enabled property value
+ * @param[in] enabledPropVal - set the enabled property value
+ *
+ * @return NULL
+ *
+ * @note Same as the synchronous API but, the service name is got through
+ *       the pipeline if it is not cached, and the failure is just traced
+ *       when the reply arrives.
+ */
+void setEnabledProperty(dbus_async::CallPipeline& pipeline,
+                        sdbusplus::bus::bus& bus,
+                        const std::string& dbusObjPath, bool enabledPropVal);
+
+/**
+ * @brief Used to set the Enabled property value of the given dbus object
+ *        paths without waiting for the D-Bus reply
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] dbusObjPaths - The object paths to set enabled property value
+ * @param[in] enabledPropVal - set the enabled property value
+ *
+ * @return NULL
+ *
+ * @note The objects which are hosted by the Inventory Manager are updated
+ *       by using the single "Notify" method call, and the failure is just
+ *       traced when the reply arrives like the single object path API.
+ */
+void setEnabledProperty(dbus_async::CallPipeline& pipeline,
+                        sdbusplus::bus::bus& bus,
+                        const std::vector<std::string>& dbusObjPaths,
+                        bool enabledPropVal);
+
 /**
  * @brief Used to get BMC log object path by using EID (aka PEL ID)
  *
@@ -190,6 +358,34 @@ void setEnabledProperty(sdbusplus::bus::bus& bus,
 std::optional<sdbusplus::message::object_path>
     getBMCLogPath(sdbusplus::bus::bus& bus, const uint32_t eid);
 
+/**
+ * @brief The handler to receive the BMC log object path
+ *
+ * @param[in] bmcLogPath - The BMC log object path
+ *                         Empty optional on failure
+ */
+using BMCLogPathHandler = std::function<void(
+    const std::optional<sdbusplus::message::object_path>& bmcLogPath)>;
+
+/**
+ * @brief Used to get BMC log object path by using EID (aka PEL ID)
+ *        without waiting for the D-Bus reply
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] eid - The EID (aka PEL ID) to get BMC log object path
+ * @param[in] handler - The handler to invoke with the BMC log object path
+ *
+ * @return NULL
+ *
+ * @note The handler is invoked immediately if the D-Bus method call
+ *       is not required (no BMC error log). The logging service name is
+ *       got through the pipeline if it is not cached.
+ */
+void getBMCLogPath(dbus_async::CallPipeline& pipeline,
+                   sdbusplus::bus::bus& bus, const uint32_t eid,
+                   BMCLogPathHandler handler);
+
 /**
  * @brief Helper function to get the instance id from the given
  *        D-Bus object path segment.
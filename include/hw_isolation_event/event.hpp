@@ -26,9 +26,6 @@ using EventMsg = std::string;
 using AssociationDefInterface =
     sdbusplus::xyz::openbmc_project::Association::server::Definitions;
 
-constexpr auto HW_ISOLATION_EVENT_PERSIST_PATH =
-    "/var/lib/op-hw-isolation/persistdata/event/hw_status/{}";
-
 /**
  * @class Event
  *
@@ -3,11 +3,18 @@
 #pragma once
 
 #include "common/isolatable_hardwares.hpp"
+#include "common/watch.hpp"
 #include "hw_isolation_event/event.hpp"
 #include "hw_isolation_record/entry.hpp"
 #include "hw_isolation_record/manager.hpp"
 
 #include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <filesystem>
+#include <queue>
+#include <set>
+#include <unordered_map>
 
 namespace hw_isolation
 {
@@ -18,6 +25,25 @@ namespace hw_status
 
 using HwStatusEvents = std::map<EventId, std::unique_ptr<Event>>;
 
+/**
+ * @brief The hardware status events id by using the hardware inventory
+ *        path (the "event_indicator" association).
+ */
+using HwStatusEventsByHwPath = std::unordered_multimap<std::string, EventId>;
+
+/**
+ * @brief The hardware state which is used to create the hardware status
+ *        event i.e. (present, functional, deconfiguredByEid) from the
+ *        ATTR_HWAS_STATE and the hardware inventory path.
+ */
+using HwState = std::tuple<bool, bool, uint32_t>;
+using HwStateInfo = std::pair<HwState, std::string>;
+
+/**
+ * @brief The last processed hardware state by using the pdbg target path.
+ */
+using HwsStateInfo = std::map<std::string, HwStateInfo>;
+
 /**
  *  @class Manager
  *
@@ -71,6 +97,16 @@ class Manager
      */
     HwStatusEvents _hwStatusEvents;
 
+    /**
+     * @brief The hardware status events id by using the hardware inventory
+     *        path to look up the events without walking the associations
+     *        of all the events.
+     *
+     * @note Must be updated whenever the hardware status event list
+     *       is updated.
+     */
+    HwStatusEventsByHwPath _hwStatusEventsByHwPath;
+
     /**
      * @brief Used to get isolatable hardware details
      */
@@ -109,6 +145,31 @@ class Manager
                                    sdeventplus::ClockId::Monotonic>>>>
         _deallocatedHwHandler;
 
+    /**
+     * @brief The last processed hardware state which is used to recreate
+     *        the hardware status event only for the changed hardware
+     *        when the phal cec device tree is changed.
+     */
+    HwsStateInfo _hwsStateInfo;
+
+    /**
+     * @brief Watcher to reload the phal cec device tree if changed.
+     */
+    std::unique_ptr<watch::inotify::Watch> _devTreeWatch;
+
+    /**
+     * @brief Used to reload the phal cec device tree once the changes
+     *        are settled since the phal cec device tree might be written
+     *        in multiple steps.
+     */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>
+        _devTreeReloadTimer;
+
+    /**
+     * @brief The last write time of the phal cec device tree that is used.
+     */
+    std::filesystem::file_time_type _devTreeLastWriteTime;
+
     /**
      * @brief Create the hardware status event dbus object
      *
@@ -124,6 +185,17 @@ class Manager
         const EventSeverity& eventSeverity, const EventMsg& eventMsg,
         const std::string& hwInventoryPath, const std::string& bmcErrorLogPath);
 
+    /**
+     * @brief Used to add the given hardware status event into the hardware
+     *        status event list and the hardware inventory path index
+     *
+     * @param[in] eventId - The hardware status event id
+     * @param[in] event - The hardware status event
+     *
+     * @return NULL
+     */
+    void addHwStatusEvent(const EventId eventId, std::unique_ptr<Event> event);
+
     /**
      * @brief Used to clear the old hardwares status event
      *
@@ -171,6 +243,18 @@ class Manager
      */
     void clearHwStatusEventIfexists(const std::string& hwInventoryPath);
 
+    /**
+     * @brief Used to clear the events of the hardware which are not
+     *        processed while restoring the changed hardware status events
+     *        i.e. the hardware which are removed from the phal cec device
+     *        tree.
+     *
+     * @param[in] processedHws - The processed hardware pdbg target path
+     *
+     * @return NULL
+     */
+    void clearRemovedHwsStatusEvent(const std::set<std::string>& processedHws);
+
     /**
      * @brief Used to handle the deallocated hardware at the host runtime.
      *
@@ -209,6 +293,12 @@ class Manager
      * @param[in] osRunning - used to decide whether wants to restore
      *                        cores events if the cores are deallocated
      *                        at the runtime. By default, it won't restore.
+     * @param[in] onlyChangedHws - used to recreate the hardware status
+     *                             event only for the hardware which state
+     *                             is changed since the last restore,
+     *                             and remove the event of the hardware
+     *                             which is not exist anymore.
+     *                             By default, it will recreate for all.
      *
      * @return NULL
      *
@@ -216,7 +306,32 @@ class Manager
      *       the hardware status event if any failures while
      *       processing all hardware.
      */
-    void restoreHardwaresStatusEvent(bool osRunning = false);
+    void restoreHardwaresStatusEvent(bool osRunning = false,
+                                     bool onlyChangedHws = false);
+
+    /**
+     * @brief Used to watch the phal cec device tree to reload if changed.
+     *
+     * @return NULL
+     */
+    void watchDevTree();
+
+    /**
+     * @brief Used to take appropriate action when the phal cec device tree
+     *        directory is changed.
+     *
+     * @return NULL
+     */
+    void onDevTreeChange();
+
+    /**
+     * @brief Used to reload the phal cec device tree and recreate the
+     *        hardware status event for the changed hardware if the phal
+     *        cec device tree is changed.
+     *
+     * @return NULL
+     */
+    void reloadDevTree();
 
     /**
      * @brief Helper API to restore hardware isolation status event from
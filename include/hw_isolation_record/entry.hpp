@@ -24,9 +24,6 @@ namespace record
 
 class Manager;
 
-constexpr auto HW_ISOLATION_ENTRY_PERSIST_PATH =
-    "/var/lib/op-hw-isolation/persistdata/record_entry/{}";
-
 namespace entry
 {
 
@@ -3,7 +3,9 @@
 #pragma once
 
 #include "common/common_types.hpp"
+#include "common/dbus_async.hpp"
 #include "common/isolatable_hardwares.hpp"
+#include "common/resolution_cache.hpp"
 #include "common/watch.hpp"
 #include "hw_isolation_record/entry.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
@@ -11,11 +13,14 @@
 #include "xyz/openbmc_project/Collection/DeleteAll/server.hpp"
 #include "xyz/openbmc_project/HardwareIsolation/Create/server.hpp"
 
-#include <cereal/types/set.hpp>
+#include <cereal/types/unordered_set.hpp>
+#include <sdbusplus/server/interface.hpp>
 #include <sdeventplus/event.hpp>
 #include <sdeventplus/utility/timer.hpp>
 
-#include <queue>
+#include <chrono>
+#include <set>
+#include <unordered_map>
 
 namespace hw_isolation
 {
@@ -27,13 +32,51 @@ using CreateInterface =
 using OP_CreateInterface =
     sdbusplus::org::open_power::HardwareIsolation::server::Create;
 
+/**
+ * @brief The application owned interface to isolate many hardwares in one
+ *        call (please refer yaml/org/open_power/HardwareIsolation).
+ */
+constexpr auto OP_BatchCreateInterface =
+    "org.open_power.HardwareIsolation.BatchCreate";
+
 using IsolatedHardwares =
     std::map<entry::EntryRecordId, std::unique_ptr<entry::Entry>>;
 
 using DeleteAllInterface =
     sdbusplus::xyz::openbmc_project::Collection::server::DeleteAll;
 
-using EcoCores = std::set<devtree::DevTreePhysPath>;
+using EcoCores = std::unordered_set<devtree::DevTreePhysPath,
+                                    devtree::DevTreePhysPath::Hash>;
+
+using EntriesByEntityPath =
+    std::unordered_map<devtree::DevTreePhysPath, entry::EntryRecordId,
+                       devtree::DevTreePhysPath::Hash>;
+
+/**
+ * @brief The result of each hardware of the batch isolation i.e. (the entry
+ *        object path, the D-Bus error name) where the entry object path is
+ *        "/" and the D-Bus error name is not empty if failed to isolate.
+ */
+using BatchResults =
+    std::vector<std::tuple<sdbusplus::message::object_path, std::string>>;
+
+using EntriesByInventoryPath =
+    std::unordered_map<std::string, entry::EntryRecordId>;
+
+/**
+ * @brief The guard record details which are compared to find the guard
+ *        records that are added, removed or modified since the last
+ *        processed guard record file.
+ */
+struct GuardRecordSlot
+{
+    entry::EntryRecordId recordId;
+    uint32_t elogId;
+    uint8_t errType;
+    devtree::DevTreePhysPath entityPath;
+
+    auto operator<=>(const GuardRecordSlot&) const = default;
+};
 
 /**
  *  @class Manager
@@ -44,10 +87,14 @@ using EcoCores = std::set<devtree::DevTreePhysPath>;
  *           xyz.openbmc_project.HardwareIsolation.Create
  *           xyz.openbmc_project.Collection.DeleteAll
  *           org.open_power.HardwareIsolation.Create
+ *           org.open_power.HardwareIsolation.BatchCreate
+ *
+ *  @note The Create interfaces are hosted with the own vtable instead of
+ *        the generated server bindings to reply the D-Bus method calls
+ *        once the isolation is completed (deferred reply) without blocking
+ *        the other D-Bus requests processing.
  */
-class Manager :
-    public type::ServerObject<CreateInterface, OP_CreateInterface,
-                              DeleteAllInterface>
+class Manager : public type::ServerObject<DeleteAllInterface>
 {
   public:
     Manager() = delete;
@@ -73,13 +120,13 @@ class Manager :
      *                               needs to isolate.
      *  @param[in] severity - The severity of isolating hardware.
      *
-     *  @return path The path of created
+     *  @return The task which gives the path of created
      * xyz.openbmc_project.HardwareIsolation.Entry object.
      */
-    sdbusplus::message::object_path create(
+    dbus_async::Task<sdbusplus::message::object_path> create(
         sdbusplus::message::object_path isolateHardware,
         sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
-            severity) override;
+            severity);
 
     /**
      *  @brief Implementation for CreateWithErrorLog
@@ -90,14 +137,14 @@ class Manager :
      *  @param[in] bmcErrorLog - The BMC error log caused the isolation of
      * hardware.
      *
-     *  @return path The path of created
+     *  @return The task which gives the path of created
      * xyz.openbmc_project.HardwareIsolation.Entry object.
      */
-    sdbusplus::message::object_path createWithErrorLog(
+    dbus_async::Task<sdbusplus::message::object_path> createWithErrorLog(
         sdbusplus::message::object_path isolateHardware,
         sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
             severity,
-        sdbusplus::message::object_path bmcErrorLog) override;
+        sdbusplus::message::object_path bmcErrorLog);
 
     /**
      * @brief Erase the entry from the manager
@@ -108,6 +155,25 @@ class Manager :
      */
     void eraseEntry(const entry::EntryRecordId entryRecordId);
 
+    /**
+     * @brief Resolve the given entries in a batch
+     *
+     * @param[in] entryRecordIds - The entries record id to resolve
+     * @param[in] clearRecord - use to decide whether want to clear
+     *                          records from their preserved file.
+     *                          By default, it will clear records.
+     *
+     * @return NULL
+     *
+     * @note The records are cleared in a single pass of the guard record
+     *       file if possible, the isolated hardware are enabled by using
+     *       the single Inventory Manager "Notify" method call, and the eco
+     *       cores list is persisted once for all the given entries.
+     *       The failed entries are just traced, and won't be resolved.
+     */
+    void resolveEntries(const std::vector<entry::EntryRecordId>& entryRecordIds,
+                        bool clearRecord = true);
+
     /**
      * @brief Delete all isolated hardware entires
      *
@@ -140,14 +206,39 @@ class Manager :
      * @param[in] bmcErrorLog - The BMC error log caused the isolation of
      *                          hardware.
      *
-     * @return path The path of created
-     *              xyz.openbmc_project.HardwareIsolation.Entry object.
+     * @return The task which gives the path of created
+     *         xyz.openbmc_project.HardwareIsolation.Entry object.
      */
-    sdbusplus::message::object_path createWithEntityPath(
+    dbus_async::Task<sdbusplus::message::object_path> createWithEntityPath(
         std::vector<uint8_t> entityPath,
         sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
             severity,
-        sdbusplus::message::object_path bmcErrorLog) override;
+        sdbusplus::message::object_path bmcErrorLog);
+
+    /**
+     * @brief Implementation for CreateBatch
+     *
+     * @details Used to isolate the given hardwares together by checking
+     *          whether the hardware isolation is allowed once and creating
+     *          the guard records in one pass.
+     *
+     * @param[in] isolateHardwares - The hardware inventory paths which are
+     *                               needs to isolate.
+     * @param[in] severity - The severity of isolating hardwares.
+     * @param[in] bmcErrorLog - The BMC error log caused the isolation of
+     *                          hardwares, "/" if no BMC error log.
+     *
+     * @return The task which gives the result of each given hardware
+     *         in the given order
+     *
+     * @note The whole batch is failed only if the common arguments are
+     *       invalid or the hardware isolation is not allowed.
+     */
+    dbus_async::Task<BatchResults> createBatch(
+        std::vector<sdbusplus::message::object_path> isolateHardwares,
+        sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
+            severity,
+        sdbusplus::message::object_path bmcErrorLog);
 
     /**
      * @brief Used to the isolated hardware entry information.
@@ -181,6 +272,25 @@ class Manager :
      */
     IsolatedHardwares _isolatedHardwares;
 
+    /**
+     * @brief The isolated hardwares entry record id by using the isolated
+     *        hardware entity path (raw data) to look up the entry without
+     *        comparing the entity path of all the entries.
+     *
+     * @note Must be updated whenever the isolated hardwares list is updated.
+     */
+    EntriesByEntityPath _entriesByEntityPath;
+
+    /**
+     * @brief The isolated hardwares entry record id by using the isolated
+     *        hardware inventory path (the "isolated_hw" association) to
+     *        look up the entry without walking the associations of all
+     *        the entries.
+     *
+     * @note Must be updated whenever the entry associations are updated.
+     */
+    EntriesByInventoryPath _entriesByInventoryPath;
+
     /**
      * @brief Used to get isolatable hardware details
      */
@@ -192,11 +302,51 @@ class Manager :
     watch::inotify::Watch _guardFileWatch;
 
     /**
-     * @brief Timer to wake and process hardware isolation record file
+     * @brief Timer to process hardware isolation record file once
+     *        the changes are settled.
+     *
+     * @note All the changes until the timer is expired are processed
+     *       together.
+     */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>
+        _guardFileSettleTimer;
+
+    /**
+     * @brief Timer to confirm the inventory paths which are served from
+     *        the warm-start resolution cache in the background.
+     */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>
+        _resolutionConfirmTimer;
+
+    /**
+     * @brief The time of the first hardware isolation record file change
+     *        that is not processed yet.
+     */
+    std::chrono::steady_clock::time_point _guardFileFirstChange;
+
+    /**
+     * @brief The time of the last hardware isolation record file change.
+     */
+    std::chrono::steady_clock::time_point _guardFileLastChange;
+
+    /**
+     * @brief Used to indicate whether the hardware isolation record file
+     *        is being read by the I/O executor to process.
      */
-    std::queue<std::unique_ptr<
-        sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>>>
-        _timerObjs;
+    bool _guardFileReadInProgress{false};
+
+    /**
+     * @brief The last processed guard record file content (image) that is
+     *        used to skip processing if the guard record file is rewritten
+     *        with the same content.
+     */
+    std::vector<uint8_t> _guardFileImage;
+
+    /**
+     * @brief The last processed guard records (sorted) that are used to
+     *        process only the changed guard records.
+     */
+    std::vector<GuardRecordSlot> _guardRecordSlots;
 
     /**
      * @brief Used to maintain isolated eco core records.
@@ -208,6 +358,44 @@ class Manager :
      */
     EcoCores _persistedEcoCores;
 
+    /**
+     * @brief Used to indicate whether the eco cores list is changed
+     *        since it is persisted.
+     */
+    bool _ecoCoresChanged{false};
+
+    /**
+     * @brief The isolated hardware records which are waiting for the D-Bus
+     *        replies to create the D-Bus entry.
+     */
+    std::set<entry::EntryRecordId> _pendingRecords;
+
+    /**
+     * @brief The xyz.openbmc_project.HardwareIsolation.Create interface
+     */
+    sdbusplus::server::interface::interface _createIface;
+
+    /**
+     * @brief The org.open_power.HardwareIsolation.Create interface
+     */
+    sdbusplus::server::interface::interface _opCreateIface;
+
+    /**
+     * @brief The org.open_power.HardwareIsolation.BatchCreate interface
+     */
+    sdbusplus::server::interface::interface _opBatchCreateIface;
+
+    /**
+     * @brief Used to pipeline the D-Bus method calls that are required
+     *        to create and update the D-Bus entries for the isolated
+     *        hardware records.
+     *
+     * @note Must be the last member to cancel the in-flight D-Bus method
+     *       calls before destroying the other members that are used by
+     *       the reply handlers.
+     */
+    dbus_async::CallPipeline _dbusCallPipeline;
+
     /**
      * @brief Allow cereal class access to allow save and load functions
      *        to be private
@@ -258,11 +446,11 @@ class Manager :
      * @param[in] bmcErrorLog - The BMC error log dbus object path to
      *                          get EID
      *
-     * @return EID (aka PEL ID) on success
+     * @return The task which gives EID (aka PEL ID) on success
      *         Empty optional on failure
      */
-    std::optional<uint32_t>
-        getEID(const sdbusplus::message::object_path& bmcErrorLog) const;
+    dbus_async::Task<std::optional<uint32_t>>
+        getEID(sdbusplus::message::object_path bmcErrorLog);
 
     /**
      * @brief Create a entry dbus object for isolated hardware
@@ -287,6 +475,29 @@ class Manager :
                     const std::string& bmcErrorLog, const bool deleteRecord,
                     const openpower_guard::EntityPath& entityPath);
 
+    /**
+     * @brief Used to create the guard record for the given hardware and
+     *        create the dbus entry (or update if exists) for the created
+     *        guard record
+     *
+     * @param[in] devTreePhysPath - the hardware physical path to isolate
+     * @param[in] eId - The EID (aka PEL ID) caused the isolation
+     * @param[in] guardType - the guard type of hardware isolation
+     * @param[in] severity - the severity of hardware isolation
+     * @param[in] isolatedHwInventoryPath - the hardware inventory path
+     * @param[in] bmcErrorLog - The error log which caused the hardware
+     *                          isolation
+     *
+     * @return entry object path on success
+     *         Throw exception on failure
+     */
+    sdbusplus::message::object_path
+        isolateHw(const devtree::DevTreePhysPath& devTreePhysPath,
+                  const uint32_t eId, const openpower_guard::GardType guardType,
+                  const entry::EntrySeverity severity,
+                  const std::string& isolatedHwInventoryPath,
+                  const std::string& bmcErrorLog);
+
     /**
      * @brief Update a entry dbus object for isolated hardware if exists
      *
@@ -313,10 +524,10 @@ class Manager :
      *
      * @param[in] severity - the severity of hardware isolation
      *
-     * @return Throw appropriate exception if not allowed
+     * @return The task which throws appropriate exception if not allowed
      *         NULL if allowed
      */
-    void isHwIsolationAllowed(const entry::EntrySeverity& severity);
+    dbus_async::Task<> isHwIsolationAllowed(entry::EntrySeverity severity);
 
     /**
      * @brief Create dbus entry object for isolated hardware record
@@ -332,6 +543,10 @@ class Manager :
      *       dbus entry if any failure since this is restoring mechanism
      *       so the hardware isolation application need to create dbus entries
      *       for all isolated hardware that is stored in the preserved location.
+     *
+     * @note The dbus entry is created when the required D-Bus replies
+     *       are arrived so, the given record is kept in the pending records
+     *       until the dbus entry is created.
      */
     void createEntryForRecord(const openpower_guard::GuardRecord& record,
                               const bool isRestorePath = false);
@@ -348,16 +563,110 @@ class Manager :
      *       dbus entry if any failure since this is restoring mechanism
      *       so the hardware isolation application need to update dbus entries
      *       for all isolated hardware that is stored in the preserved location.
+     *
+     * @note The dbus entry is updated when the required D-Bus replies
+     *       are arrived.
      */
     void updateEntryForRecord(const openpower_guard::GuardRecord& record,
                               IsolatedHardwares::iterator& entryIt);
 
+    /**
+     * @brief Callback to process hardware isolation record file if
+     *        the changes are settled.
+     *
+     * @details The hardware isolation record file is considered as settled
+     *          if it is not changed (no write notification and no write
+     *          time update) for the quiet period, otherwise the timer is
+     *          restarted for the remaining quiet period. The processing is
+     *          not deferred beyond the maximum settle delay even if the file
+     *          keeps changing.
+     *
+     * @return NULL
+     */
+    void onGuardFileSettleTimeout();
+
+    /**
+     * @brief Callback to confirm the inventory paths which are served from
+     *        the warm-start resolution cache while restoring
+     *
+     * @details The inventory paths are confirmed by using the live lookup
+     *          in the small batches to avoid blocking the D-Bus requests
+     *          processing, and the warm start is ended once all the served
+     *          inventory paths are confirmed.
+     *
+     * @return NULL
+     */
+    void onResolutionConfirmTimeout();
+
+    /**
+     * @brief Used to confirm the given served inventory path by using
+     *        the live lookup, and update the respective entry if the
+     *        inventory path is changed.
+     *
+     * @param[in] key - The resolution key of the served inventory path
+     * @param[in] servedResolution - The served inventory path
+     *
+     * @return NULL
+     */
+    void confirmResolution(
+        const resolution_cache::ResolutionKey& key,
+        const resolution_cache::Resolution& servedResolution);
+
+    /**
+     * @brief Used to read the hardware isolation record file in the I/O
+     *        executor, and process the host isolated hardwares once read.
+     *
+     * @return NULL
+     *
+     * @note Nothing is processed if the hardware isolation record file
+     *       content is not changed since the last processed file.
+     */
+    void readHostIsolatedHardwares();
+
     /**
      * @brief Callback to add the dbus entry for host isolated hardwares.
      *
+     * @param[in] guardFileImage - The guard record file content
+     * @param[in] records - The persistent type guard records
+     *
      * @return NULL
+     *
+     * @note Only the dbus entries of the hardwares which guard records are
+     *       added, removed or modified since the last processed guard
+     *       record file are reconciled, and the dbus entries which are
+     *       failed to create earlier are retried.
      */
-    void handleHostIsolatedHardwares();
+    void handleHostIsolatedHardwares(std::vector<uint8_t>&& guardFileImage,
+                                     openpower_guard::GuardRecords&& records);
+
+    /**
+     * @brief Used to create the dbus entry for the valid guard records
+     *        which don't have the dbus entry and are not waiting for
+     *        the D-Bus replies.
+     *
+     * @param[in] records - The persistent type guard records
+     *
+     * @return true if the dbus entry creation is started for any record
+     *         false otherwise
+     *
+     * @note The records which dbus entry creation is failed earlier are
+     *       retried as well.
+     */
+    bool createMissingEntries(const openpower_guard::GuardRecords& records);
+
+    /**
+     * @brief Used to save the given guard records and the guard record
+     *        file content as the last processed guard record file.
+     *
+     * @param[in] records - The guard records to save
+     * @param[in] guardFileImage - The guard record file content to save
+     *
+     * @return The guard records which are changed since the last processed
+     *         guard record file
+     */
+    std::vector<GuardRecordSlot>
+        saveGuardRecords(const openpower_guard::GuardRecords& records,
+                         std::vector<uint8_t>&& guardFileImage);
 
     /**
      * @brief Resolve all entries.
@@ -372,6 +681,30 @@ class Manager :
      */
     void resolveAllEntries(bool clearRecord = true);
 
+    /**
+     * @brief Used to clear the given guard records
+     *
+     * @param[in] recordIds - The guard records id to clear
+     *
+     * @return The guard records id which are cleared
+     *
+     * @note All the guard records are cleared by using the single pass of
+     *       the guard record file if the given records are the only records
+     *       in the file, otherwise the records are cleared one by one.
+     */
+    std::vector<entry::EntryRecordId>
+        clearGuardRecords(const std::vector<entry::EntryRecordId>& recordIds);
+
+    /**
+     * @brief Used to remove the entry and its indexes from the manager
+     *        without persisting the eco cores list
+     *
+     * @param[in] entryRecordId - The entry record id to remove
+     *
+     * @return NULL
+     */
+    void removeEntry(const entry::EntryRecordId entryRecordId);
+
     /**
      * @brief Helper API to check whether hardware isolation record
      *        is valid or not.
@@ -397,15 +730,55 @@ class Manager :
      * @param[in] coreDevTreePhysPath - The core device tree physical path.
      *
      * @return NULL
+     *
+     * @note The eco cores list is not persisted by this API so, the caller
+     *       must use flushEcoCores() once all the changes are done (for
+     *       example, at the end of the restore or the batch).
      */
     void
         updateEcoCoresList(const bool ecoCore,
                            const devtree::DevTreePhysPath& coreDevTreePhysPath);
 
+    /**
+     * @brief Used to persist the eco cores list if it is changed
+     *
+     * @return NULL
+     */
+    void flushEcoCores();
+
+    /**
+     * @brief Used to get the isolated hardware entry by using the isolated
+     *        hardware entity path
+     *
+     * @param[in] entityPath - The isolated hardware entity path (raw data)
+     *
+     * @return The entry iterator on success
+     *         The end iterator of the isolated hardwares if not found
+     */
+    IsolatedHardwares::iterator
+        findEntry(const devtree::DevTreePhysPath& entityPath);
+
+    /**
+     * @brief Used to update the isolated hardware inventory path index
+     *        of the given entry when the entry associations are changed
+     *
+     * @param[in] recordId - The entry record id
+     * @param[in] oldAssociations - The entry associations before change
+     * @param[in] newAssociations - The entry associations after change
+     *
+     * @return NULL
+     */
+    void updateInventoryPathIndex(const entry::EntryRecordId recordId,
+                                  const type::AssociationDef& oldAssociations,
+                                  const type::AssociationDef& newAssociations);
+
     /**
      * @brief Helper API to cleanup persisted eco cores
      *
      * @return NULL
+     *
+     * @note The eco cores list is persisted (flushed) at the end so, this
+     *       should be used at the end of the restore and reconciliation.
      */
     void cleanupPersistedEcoCores();
 };
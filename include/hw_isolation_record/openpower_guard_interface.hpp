@@ -5,6 +5,8 @@
 #include <libguard/guard_interface.hpp>
 
 #include <filesystem>
+#include <functional>
+#include <vector>
 
 namespace hw_isolation
 {
@@ -45,6 +47,24 @@ std::optional<GuardRecord> create(const EntityPath& entityPath,
  */
 void clear(const uint32_t recordId);
 
+/**
+ * @brief Wrapper function for libguard::clearAll to delete all guard
+ *        records in a single pass of the guard record file if the given
+ *        check allows
+ *
+ * @param[in] canClearAll - Used to check whether all the guard records
+ *                          (all types) can be deleted.
+ *
+ * @return true if all the guard records are deleted
+ *         false if the given check is not allowed to delete
+ *         Throw exception on failure
+ *
+ * @note The guard records are got and deleted under the same libguard
+ *       lock so, the guard records which are created after the check
+ *       won't be deleted.
+ */
+bool clearAllIf(const std::function<bool(const GuardRecords&)>& canClearAll);
+
 /**
  * @brief Wrapper function for libguard::getAll to get all guard records
  *
@@ -64,5 +84,16 @@ GuardRecords getAll(bool persistentTypeOnly = false);
  *         Throw exception on failure
  */
 const fs::path getGuardFilePath();
+
+/**
+ * @brief Used to read the whole guard record file (image) content
+ *
+ * @return The guard record file content on success
+ *         Throw exception on failure
+ *
+ * @note The image is used to find whether the guard record file content is
+ *       changed without parsing the guard records.
+ */
+std::vector<uint8_t> readGuardFile();
 } // namespace openpower_guard
 } // namespace hw_isolation
@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/dbus_async.hpp"
+
+#include "common/common_types.hpp"
+
+#include <fmt/format.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace hw_isolation
+{
+namespace dbus_async
+{
+
+using namespace phosphor::logging;
+
+CallPipeline::CallPipeline(sdbusplus::bus::bus& bus, size_t maxInFlight) :
+    _bus(bus), _maxInFlight(std::max<size_t>(maxInFlight, 1))
+{}
+
+CallPipeline::~CallPipeline()
+{
+    // The resumed coroutines might add the D-Bus method calls again
+    // so, those are cancelled immediately.
+    _cancelled = true;
+    _idleHandlers.clear();
+
+    auto inFlightCalls = std::move(_inFlightCalls);
+    _inFlightCalls.clear();
+    std::ranges::for_each(inFlightCalls, [](auto& call) {
+        call->slot = sd_bus_slot_unref(call->slot);
+        cancel(*call);
+    });
+
+    while (!_pendingCalls.empty())
+    {
+        auto call = std::move(_pendingCalls.front());
+        _pendingCalls.pop_front();
+        cancel(*call);
+    }
+}
+
+void CallPipeline::call(sdbusplus::message::message&& method,
+                        ReplyHandler handler)
+{
+    call(std::move(method), std::move(handler), false);
+}
+
+void CallPipeline::call(sdbusplus::message::message&& method,
+                        ReplyHandler handler, bool handleCancel)
+{
+    auto newCall = std::make_unique<Call>(Call{
+        std::move(method), std::move(handler), nullptr, this, handleCancel});
+    if (_cancelled)
+    {
+        cancel(*newCall);
+        return;
+    }
+    _pendingCalls.emplace_back(std::move(newCall));
+    dispatch();
+}
+
+CallAwaiter CallPipeline::awaitCall(sdbusplus::message::message&& method)
+{
+    return CallAwaiter(*this, std::move(method));
+}
+
+void CallPipeline::onIdle(IdleHandler handler)
+{
+    if (_cancelled)
+    {
+        return;
+    }
+    _idleHandlers.emplace_back(std::move(handler));
+    dispatch();
+}
+
+bool CallPipeline::idle() const
+{
+    return _pendingCalls.empty() && _inFlightCalls.empty();
+}
+
+void CallPipeline::usePrivateBus()
+{
+    if (_privateBus.has_value() || !idle())
+    {
+        return;
+    }
+
+    sd_bus* privateBus{nullptr};
+    auto ret = sd_bus_open_system(&privateBus);
+    if (ret < 0)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to open the private bus connection with "
+                        "ErrNo [{}] and ErrMsg [{}], using the shared bus",
+                        -ret, strerror(-ret))
+                .c_str());
+        return;
+    }
+    _privateBus.emplace(privateBus, std::false_type());
+}
+
+void CallPipeline::waitIdle()
+{
+    auto& bus = _privateBus.has_value() ? *_privateBus : _bus;
+    while (!idle())
+    {
+        if (!bus.process_discard())
+        {
+            bus.wait();
+        }
+    }
+    _privateBus.reset();
+}
+
+void CallPipeline::dispatch()
+{
+    while (!_pendingCalls.empty() && (_inFlightCalls.size() < _maxInFlight))
+    {
+        auto call = std::move(_pendingCalls.front());
+        _pendingCalls.pop_front();
+
+        // Use the default method call timeout.
+        auto& bus = _privateBus.has_value() ? *_privateBus : _bus;
+        auto ret = sd_bus_call_async(bus.get(), &call->slot,
+                                     call->method.get(), CallPipeline::onReply,
+                                     call.get(), 0);
+        if (ret < 0)
+        {
+            log<level::ERR>(
+                fmt::format("Failed to send the D-Bus method call [{}] to "
+                            "[{}] with ErrNo [{}] and ErrMsg [{}]",
+                            call->method.get_member(),
+                            call->method.get_destination(), -ret,
+                            strerror(-ret))
+                    .c_str());
+
+            sd_bus_error error = SD_BUS_ERROR_NULL;
+            sd_bus_error_set_errno(&error, ret);
+
+            sdbusplus::message::message reply;
+            invokeHandler(*call, reply, &error);
+            sd_bus_error_free(&error);
+            continue;
+        }
+        _inFlightCalls.emplace_back(std::move(call));
+    }
+
+    if (idle() && !_idleHandlers.empty())
+    {
+        auto idleHandlers = std::move(_idleHandlers);
+        _idleHandlers.clear();
+        std::ranges::for_each(idleHandlers,
+                              [](const auto& handler) { handler(); });
+    }
+}
+
+void CallPipeline::complete(Call* call, sdbusplus::message::message& reply)
+{
+    auto inFlightCall = std::ranges::find_if(
+        _inFlightCalls,
+        [call](const auto& ele) { return ele.get() == call; });
+    if (inFlightCall == _inFlightCalls.end())
+    {
+        return;
+    }
+
+    auto completedCall = std::move(*inFlightCall);
+    _inFlightCalls.erase(inFlightCall);
+
+    const sd_bus_error* error{nullptr};
+    if (reply.is_method_error())
+    {
+        error = sd_bus_message_get_error(reply.get());
+    }
+
+    invokeHandler(*completedCall, reply, error);
+
+    sd_bus_slot_unref(completedCall->slot);
+
+    dispatch();
+}
+
+void CallPipeline::invokeHandler(Call& call,
+                                 sdbusplus::message::message& reply,
+                                 const sd_bus_error* error)
+{
+    try
+    {
+        call.handler(reply, error);
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while handling the D-Bus method "
+                        "call [{}] reply",
+                        e.what(), call.method.get_member())
+                .c_str());
+    }
+}
+
+void CallPipeline::cancel(Call& call)
+{
+    if (!call.handleCancel)
+    {
+        return;
+    }
+
+    sd_bus_error error = SD_BUS_ERROR_NULL;
+    sd_bus_error_set_errno(&error, ECANCELED);
+
+    sdbusplus::message::message reply;
+    invokeHandler(call, reply, &error);
+    sd_bus_error_free(&error);
+}
+
+int CallPipeline::onReply(sd_bus_message* reply, void* userData,
+                          sd_bus_error* /*retError*/)
+{
+    auto call = static_cast<Call*>(userData);
+
+    sdbusplus::message::message replyMsg(reply);
+    call->pipeline->complete(call, replyMsg);
+
+    return 0;
+}
+
+CallAwaiter::CallAwaiter(CallPipeline& pipeline,
+                         sdbusplus::message::message&& method) :
+    _pipeline(pipeline),
+    _method(std::move(method))
+{}
+
+CallAwaiter::~CallAwaiter()
+{
+    sd_bus_error_free(&_error);
+}
+
+void CallAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    // The coroutine might be resumed (and this awaiter might be destroyed)
+    // before returning from the pipeline call if failed to send the method
+    // call so, this awaiter must not be used after the pipeline call.
+    _pipeline.call(
+        std::move(_method),
+        [this, handle](sdbusplus::message::message& reply,
+                       const sd_bus_error* error) {
+            if (error != nullptr)
+            {
+                sd_bus_error_copy(&_error, error);
+            }
+            else
+            {
+                _reply = reply;
+            }
+            handle.resume();
+        },
+        true);
+}
+
+sdbusplus::message::message CallAwaiter::await_resume()
+{
+    if (sd_bus_error_is_set(&_error))
+    {
+        throw sdbusplus::exception::SdBusError(&_error, "HW-Isolation");
+    }
+    return std::move(_reply);
+}
+
+void details::Detached::promise_type::unhandled_exception()
+{
+    try
+    {
+        throw;
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] in the detached coroutine", e.what())
+                .c_str());
+    }
+    catch (...)
+    {
+        log<level::ERR>("Unknown exception in the detached coroutine");
+    }
+}
+
+void replyError(sdbusplus::message::message& methodCall,
+                const sdbusplus::exception::exception& error)
+{
+    auto ret = sd_bus_reply_method_errorf(methodCall.get(), error.name(), "%s",
+                                          error.description());
+    if (ret < 0)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to reply the D-Bus method call [{}] with "
+                        "the error [{}], ErrNo [{}] and ErrMsg [{}]",
+                        methodCall.get_member(), error.name(), -ret,
+                        strerror(-ret))
+                .c_str());
+    }
+}
+
+void replyInternalFailure(sdbusplus::message::message& methodCall,
+                          const char* what)
+{
+    log<level::ERR>(fmt::format("Exception [{}] while processing the D-Bus "
+                                "method call [{}]",
+                                what, methodCall.get_member())
+                        .c_str());
+
+    replyError(methodCall, type::CommonError::InternalFailure());
+}
+
+} // namespace dbus_async
+} // namespace hw_isolation
@@ -0,0 +1,783 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/inventory_model.hpp"
+
+#include "common/phal_devtree_utils.hpp"
+#include "common/utils.hpp"
+
+#include <fmt/format.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <variant>
+
+namespace hw_isolation
+{
+namespace inventory
+{
+
+using namespace phosphor::logging;
+
+constexpr auto InventoryRootPath = "/xyz/openbmc_project/inventory";
+constexpr auto ItemIface = "xyz.openbmc_project.Inventory.Item";
+constexpr auto LocationCodeIface =
+    "xyz.openbmc_project.Inventory.Decorator.LocationCode";
+constexpr auto OperationalStatusIface =
+    "xyz.openbmc_project.State.Decorator.OperationalStatus";
+
+namespace dbus_type
+{
+using Interface = std::string;
+using Property = std::string;
+using PropertyValue =
+    std::variant<std::string, bool, uint8_t, int16_t, uint16_t, int32_t,
+                 uint32_t, int64_t, uint64_t, double, std::vector<uint8_t>,
+                 std::vector<std::string>>;
+using Properties = std::map<Property, PropertyValue>;
+using Interfaces = std::map<Interface, Properties>;
+using ManagedObjects = std::map<sdbusplus::message::object_path, Interfaces>;
+using SubTree = std::map<std::string, ObjectServices>;
+} // namespace dbus_type
+
+/**
+ * @brief The inventory object details which are used to look up
+ *        the inventory.
+ */
+struct InventoryObject
+{
+    ObjectServices services;
+    std::optional<std::string> prettyName;
+    std::optional<LocationCode> locationCode;
+    std::optional<bool> functional;
+
+    /**
+     * @brief The unexpanded format of the locationCode which is computed
+     *        only once and reset whenever the locationCode is changed.
+     */
+    std::optional<std::optional<LocationCode>> unexpandedLocCode;
+};
+
+/**
+ * @brief The inventory objects by using the object path which is sorted
+ *        to get the inventory subtree.
+ */
+static std::map<std::string, InventoryObject> inventoryObjects;
+
+/**
+ * @brief Used to indicate whether the inventory model is up to date
+ */
+static bool inventoryModelValid{false};
+
+/**
+ * @brief The inventory services name by using the service unique name
+ *        to find the service of the inventory signals.
+ */
+static std::map<std::string, std::string> serviceNamesByOwner;
+
+/**
+ * @brief The list of D-Bus match objects to update the inventory model
+ *        if the inventory is changed.
+ */
+static std::vector<std::unique_ptr<sdbusplus::bus::match::match>>
+    inventoryChangeWatcher;
+
+/**
+ * @brief Helper function to fill the required properties of the given
+ *        interface in the inventory object
+ *
+ * @param[in] interfaceName - The interface name of the properties
+ * @param[in] properties - The properties to fill
+ * @param[out] object - The inventory object to fill
+ *
+ * @return NULL
+ */
+static void fillProperties(const std::string& interfaceName,
+                           const dbus_type::Properties& properties,
+                           InventoryObject& object)
+{
+    auto getProp = [&properties]<typename T>(const std::string& prop,
+                                             std::optional<T>& value) {
+        auto propIt = properties.find(prop);
+        if (propIt == properties.end())
+        {
+            return false;
+        }
+        if (const auto* propVal = std::get_if<T>(&propIt->second))
+        {
+            value = *propVal;
+        }
+        else
+        {
+            value.reset();
+        }
+        return true;
+    };
+
+    if (interfaceName == ItemIface)
+    {
+        getProp("PrettyName", object.prettyName);
+    }
+    else if (interfaceName == LocationCodeIface)
+    {
+        if (getProp("LocationCode", object.locationCode))
+        {
+            object.unexpandedLocCode.reset();
+        }
+    }
+    else if (interfaceName == OperationalStatusIface)
+    {
+        getProp("Functional", object.functional);
+    }
+}
+
+/**
+ * @brief Helper function to drop the given invalidated properties
+ *        of the given interface from the inventory object
+ *
+ * @param[in] interfaceName - The interface name of the properties
+ * @param[in] properties - The invalidated properties name
+ * @param[out] object - The inventory object to update
+ *
+ * @return NULL
+ */
+static void dropProperties(const std::string& interfaceName,
+                           const std::vector<std::string>& properties,
+                           InventoryObject& object)
+{
+    for (const auto& prop : properties)
+    {
+        if ((interfaceName == ItemIface) && (prop == "PrettyName"))
+        {
+            object.prettyName.reset();
+        }
+        else if ((interfaceName == LocationCodeIface) &&
+                 (prop == "LocationCode"))
+        {
+            object.locationCode.reset();
+            object.unexpandedLocCode.reset();
+        }
+        else if ((interfaceName == OperationalStatusIface) &&
+                 (prop == "Functional"))
+        {
+            object.functional.reset();
+        }
+    }
+}
+
+/**
+ * @brief Helper function to drop all the required properties of the given
+ *        interface from the inventory object
+ *
+ * @param[in] interfaceName - The removed interface name
+ * @param[out] object - The inventory object to update
+ *
+ * @return NULL
+ */
+static void dropInterface(const std::string& interfaceName,
+                          InventoryObject& object)
+{
+    dropProperties(interfaceName, {"PrettyName", "LocationCode", "Functional"},
+                   object);
+}
+
+/**
+ * @brief Used to prefetch the whole inventory into the inventory model
+ *
+ * @param[in] bus - Bus to attach to.
+ *
+ * @return true on success
+ *         false on failure
+ */
+static bool prefetchInventory(sdbusplus::bus::bus& bus)
+{
+    inventoryObjects.clear();
+    serviceNamesByOwner.clear();
+    inventoryModelValid = false;
+
+    try
+    {
+        auto method =
+            bus.new_method_call(type::ObjectMapperName, type::ObjectMapperPath,
+                                type::ObjectMapperName, "GetSubTree");
+        method.append(InventoryRootPath, 0, std::vector<std::string>());
+
+        auto reply = bus.call(method);
+
+        dbus_type::SubTree subTree;
+        reply.read(subTree);
+
+        std::set<std::string> services;
+        for (auto& [objPath, objServices] : subTree)
+        {
+            for (const auto& service : objServices)
+            {
+                services.emplace(service.first);
+            }
+            inventoryObjects[objPath].services = std::move(objServices);
+        }
+
+        // Get all the required properties in one call for each service.
+        for (const auto& service : services)
+        {
+            try
+            {
+                // The inventory signals are sent by using the service
+                // unique name.
+                auto ownerMethod = bus.new_method_call(
+                    "org.freedesktop.DBus", "/org/freedesktop/DBus",
+                    "org.freedesktop.DBus", "GetNameOwner");
+                ownerMethod.append(service);
+
+                auto ownerReply = bus.call(ownerMethod);
+
+                std::string owner;
+                ownerReply.read(owner);
+                serviceNamesByOwner.insert_or_assign(owner, service);
+
+                auto managedObjsMethod = bus.new_method_call(
+                    service.c_str(), InventoryRootPath,
+                    "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+
+                auto managedObjsReply = bus.call(managedObjsMethod);
+
+                dbus_type::ManagedObjects managedObjs;
+                managedObjsReply.read(managedObjs);
+
+                for (const auto& [objPath, interfaces] : managedObjs)
+                {
+                    auto object = inventoryObjects.find(objPath.str);
+                    if (object == inventoryObjects.end())
+                    {
+                        continue;
+                    }
+                    for (const auto& [interfaceName, properties] : interfaces)
+                    {
+                        fillProperties(interfaceName, properties,
+                                       object->second);
+                    }
+                }
+            }
+            catch (const sdbusplus::exception::exception& e)
+            {
+                // The properties of the objects which are hosted by this
+                // service will be got from the D-Bus when required.
+                log<level::DEBUG>(
+                    fmt::format("Exception [{}] to get the managed objects "
+                                "from the service [{}]",
+                                e.what(), service)
+                        .c_str());
+            }
+        }
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] to prefetch the inventory", e.what())
+                .c_str());
+        inventoryObjects.clear();
+        serviceNamesByOwner.clear();
+        return false;
+    }
+
+    inventoryModelValid = true;
+    return true;
+}
+
+/**
+ * @brief Used to get the up to date inventory model
+ *
+ * @param[in] bus - Bus to attach to.
+ *
+ * @return true if the inventory model is available to look up
+ *         false if not
+ */
+static bool isInventoryModelReady(sdbusplus::bus::bus& bus)
+{
+    if (inventoryChangeWatcher.empty())
+    {
+        // Don't use the inventory model since it can't be invalidated
+        // if the inventory is changed.
+        return false;
+    }
+
+    if (!inventoryModelValid)
+    {
+        return prefetchInventory(bus);
+    }
+    return true;
+}
+
+/**
+ * @brief Helper function to get the given inventory object from the model
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objPath - The inventory object path
+ *
+ * @return The inventory object if found
+ *         nullptr if not found or the inventory model is not available
+ */
+static InventoryObject*
+    getInventoryObject(sdbusplus::bus::bus& bus,
+                       const sdbusplus::message::object_path& objPath)
+{
+    if (!isInventoryModelReady(bus))
+    {
+        return nullptr;
+    }
+
+    auto object = inventoryObjects.find(objPath.str);
+    if (object == inventoryObjects.end())
+    {
+        return nullptr;
+    }
+    return &object->second;
+}
+
+/**
+ * @brief Callback to update the inventory model by using
+ *        the PropertiesChanged signal
+ *
+ * @details The required properties are updated in the place so,
+ *          the whole inventory need not prefetch again for the
+ *          property change.
+ *
+ * @param[in] message - The D-Bus signal message
+ *
+ * @return NULL
+ */
+static void onInventoryPropertiesChanged(sdbusplus::message::message& message)
+{
+    if (!inventoryModelValid)
+    {
+        // The whole inventory will be prefetched when it is required.
+        return;
+    }
+
+    try
+    {
+        std::string interfaceName;
+        dbus_type::Properties changedProperties;
+        std::vector<std::string> invalidatedProperties;
+
+        message.read(interfaceName, changedProperties, invalidatedProperties);
+
+        if ((interfaceName != ItemIface) &&
+            (interfaceName != LocationCodeIface) &&
+            (interfaceName != OperationalStatusIface))
+        {
+            return;
+        }
+
+        auto object = inventoryObjects.find(message.get_path());
+        if (object == inventoryObjects.end())
+        {
+            // Not yet known object, the model will be updated
+            // by using the InterfacesAdded signal.
+            return;
+        }
+
+        fillProperties(interfaceName, changedProperties, object->second);
+        dropProperties(interfaceName, invalidatedProperties, object->second);
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while reading the PropertiesChanged "
+                        "signal of the inventory object [{}]",
+                        e.what(), message.get_path())
+                .c_str());
+        inventoryModelValid = false;
+    }
+}
+
+/**
+ * @brief Helper function to get the inventory service name of the given
+ *        inventory signal
+ *
+ * @param[in] message - The D-Bus signal message
+ *
+ * @return The inventory service name if the sender is known
+ *         Empty optional if not known
+ */
+static std::optional<std::string>
+    getSignalService(sdbusplus::message::message& message)
+{
+    const char* sender = message.get_sender();
+    if (sender == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    auto service = serviceNamesByOwner.find(sender);
+    if (service == serviceNamesByOwner.end())
+    {
+        return std::nullopt;
+    }
+    return service->second;
+}
+
+/**
+ * @brief Callback to update the inventory model by using
+ *        the InterfacesAdded signal
+ *
+ * @details The added interfaces and the required properties are inserted
+ *          in the place so, the whole inventory need not prefetch again
+ *          for the added objects.
+ *
+ * @param[in] message - The D-Bus signal message
+ *
+ * @return NULL
+ *
+ * @note The inventory model is prefetched again when it is required
+ *       if the signal sender is not a known inventory service (for example,
+ *       the new service is started) or the signal can't be read.
+ */
+static void onInventoryInterfacesAdded(sdbusplus::message::message& message)
+{
+    if (!inventoryModelValid)
+    {
+        // The whole inventory will be prefetched when it is required.
+        return;
+    }
+
+    auto service = getSignalService(message);
+    if (!service.has_value())
+    {
+        inventoryModelValid = false;
+        return;
+    }
+
+    try
+    {
+        sdbusplus::message::object_path objPath;
+        dbus_type::Interfaces interfaces;
+
+        message.read(objPath, interfaces);
+
+        if (!objPath.str.starts_with(InventoryRootPath))
+        {
+            return;
+        }
+
+        auto& object = inventoryObjects[objPath.str];
+        auto& serviceIfaces = object.services[*service];
+        for (const auto& [interfaceName, properties] : interfaces)
+        {
+            if (std::ranges::find(serviceIfaces, interfaceName) ==
+                serviceIfaces.end())
+            {
+                serviceIfaces.emplace_back(interfaceName);
+            }
+            fillProperties(interfaceName, properties, object);
+        }
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while reading the InterfacesAdded "
+                        "signal of the inventory",
+                        e.what())
+                .c_str());
+        inventoryModelValid = false;
+    }
+}
+
+/**
+ * @brief Callback to update the inventory model by using
+ *        the InterfacesRemoved signal
+ *
+ * @details The removed interfaces and their properties are erased in
+ *          the place, and the object is erased if no service is hosting
+ *          the object interfaces.
+ *
+ * @param[in] message - The D-Bus signal message
+ *
+ * @return NULL
+ */
+static void onInventoryInterfacesRemoved(sdbusplus::message::message& message)
+{
+    if (!inventoryModelValid)
+    {
+        // The whole inventory will be prefetched when it is required.
+        return;
+    }
+
+    auto service = getSignalService(message);
+    if (!service.has_value())
+    {
+        inventoryModelValid = false;
+        return;
+    }
+
+    try
+    {
+        sdbusplus::message::object_path objPath;
+        std::vector<std::string> interfaces;
+
+        message.read(objPath, interfaces);
+
+        auto object = inventoryObjects.find(objPath.str);
+        if (object == inventoryObjects.end())
+        {
+            return;
+        }
+
+        auto& services = object->second.services;
+        auto serviceIfaces = services.find(*service);
+        if (serviceIfaces == services.end())
+        {
+            return;
+        }
+
+        for (const auto& interfaceName : interfaces)
+        {
+            std::erase(serviceIfaces->second, interfaceName);
+            dropInterface(interfaceName, object->second);
+        }
+
+        // The standard D-Bus interfaces are not removed by using the signal.
+        auto isStandardIface = [](const auto& interfaceName) {
+            return interfaceName.starts_with("org.freedesktop.DBus.");
+        };
+        if (std::ranges::all_of(serviceIfaces->second, isStandardIface))
+        {
+            services.erase(serviceIfaces);
+        }
+        if (services.empty())
+        {
+            inventoryObjects.erase(object);
+        }
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while reading the InterfacesRemoved "
+                        "signal of the inventory",
+                        e.what())
+                .c_str());
+        inventoryModelValid = false;
+    }
+}
+
+/**
+ * @brief Callback to invalidate the inventory model if the inventory
+ *        service is restarted or exited
+ *
+ * @details The objects of the lost service are not removed by using
+ *          the InterfacesRemoved signal so, the inventory model is
+ *          prefetched again when it is required.
+ *
+ * @param[in] message - The D-Bus signal message
+ *
+ * @return NULL
+ */
+static void onInventoryServiceOwnerChanged(sdbusplus::message::message& message)
+{
+    if (!inventoryModelValid)
+    {
+        // The whole inventory will be prefetched when it is required.
+        return;
+    }
+
+    try
+    {
+        std::string name;
+        std::string oldOwner;
+        std::string newOwner;
+
+        message.read(name, oldOwner, newOwner);
+
+        if (!oldOwner.empty() && serviceNamesByOwner.contains(oldOwner))
+        {
+            inventoryModelValid = false;
+        }
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while reading the NameOwnerChanged "
+                        "signal",
+                        e.what())
+                .c_str());
+        inventoryModelValid = false;
+    }
+}
+
+void initInventoryModel(sdbusplus::bus::bus& bus)
+{
+    try
+    {
+        namespace sdbusplus_match = sdbusplus::bus::match;
+
+        // The InterfacesAdded and InterfacesRemoved signals are sent by
+        // the object manager which might be any parent of the inventory
+        // (for example, "/") so, use the object path (first argument) to
+        // match the inventory namespace.
+        auto inventoryNamespace = std::string(InventoryRootPath) + "/";
+
+        inventoryChangeWatcher.push_back(
+            std::make_unique<sdbusplus_match::match>(
+                bus,
+                sdbusplus_match::rules::interfacesAdded() +
+                    sdbusplus_match::rules::argNpath(0, inventoryNamespace),
+                onInventoryInterfacesAdded));
+
+        inventoryChangeWatcher.push_back(
+            std::make_unique<sdbusplus_match::match>(
+                bus,
+                sdbusplus_match::rules::interfacesRemoved() +
+                    sdbusplus_match::rules::argNpath(0, inventoryNamespace),
+                onInventoryInterfacesRemoved));
+
+        inventoryChangeWatcher.push_back(
+            std::make_unique<sdbusplus_match::match>(
+                bus,
+                sdbusplus_match::rules::type::signal() +
+                    sdbusplus_match::rules::member("PropertiesChanged") +
+                    sdbusplus_match::rules::interface(
+                        "org.freedesktop.DBus.Properties") +
+                    sdbusplus_match::rules::path_namespace(InventoryRootPath),
+                onInventoryPropertiesChanged));
+
+        inventoryChangeWatcher.push_back(
+            std::make_unique<sdbusplus_match::match>(
+                bus, sdbusplus_match::rules::nameOwnerChanged(),
+                onInventoryServiceOwnerChanged));
+    }
+    catch (const std::exception& e)
+    {
+        inventoryChangeWatcher.clear();
+        log<level::ERR>(
+            fmt::format("Exception [{}] while adding the D-Bus match rules "
+                        "to watch the inventory change, the inventory "
+                        "model won't be used",
+                        e.what())
+                .c_str());
+        return;
+    }
+
+    prefetchInventory(bus);
+}
+
+ObjectServices getObject(sdbusplus::bus::bus& bus,
+                         const sdbusplus::message::object_path& objPath)
+{
+    auto object = getInventoryObject(bus, objPath);
+    if (object != nullptr)
+    {
+        return object->services;
+    }
+
+    auto method =
+        bus.new_method_call(type::ObjectMapperName, type::ObjectMapperPath,
+                            type::ObjectMapperName, "GetObject");
+
+    method.append(objPath.str);
+    method.append(std::vector<std::string>({}));
+
+    auto reply = bus.call(method);
+
+    ObjectServices objServices;
+    reply.read(objServices);
+    return objServices;
+}
+
+std::optional<std::vector<sdbusplus::message::object_path>>
+    getChildsInventoryPath(sdbusplus::bus::bus& bus,
+                           const sdbusplus::message::object_path& parentObjPath,
+                           const std::string& interfaceName)
+{
+    if (!isInventoryModelReady(bus) ||
+        !parentObjPath.str.starts_with(InventoryRootPath))
+    {
+        return utils::getChildsInventoryPath(bus, parentObjPath,
+                                             interfaceName);
+    }
+
+    std::vector<sdbusplus::message::object_path> listOfChildsInventoryPath;
+
+    auto childPathPrefix = parentObjPath.str + "/";
+    for (auto object = inventoryObjects.lower_bound(childPathPrefix);
+         (object != inventoryObjects.end()) &&
+         object->first.starts_with(childPathPrefix);
+         ++object)
+    {
+        auto hasInterface = std::ranges::any_of(
+            object->second.services, [&interfaceName](const auto& service) {
+                return std::ranges::find(service.second, interfaceName) !=
+                       service.second.end();
+            });
+
+        if (hasInterface)
+        {
+            listOfChildsInventoryPath.emplace_back(object->first);
+        }
+    }
+    return listOfChildsInventoryPath;
+}
+
+std::string getPrettyName(sdbusplus::bus::bus& bus,
+                          const sdbusplus::message::object_path& objPath)
+{
+    auto object = getInventoryObject(bus, objPath);
+    if ((object != nullptr) && object->prettyName.has_value())
+    {
+        return *object->prettyName;
+    }
+
+    return utils::getDBusPropertyVal<std::string>(bus, objPath, ItemIface,
+                                                  "PrettyName");
+}
+
+LocationCode getLocationCode(sdbusplus::bus::bus& bus,
+                             const sdbusplus::message::object_path& objPath)
+{
+    auto object = getInventoryObject(bus, objPath);
+    if ((object != nullptr) && object->locationCode.has_value())
+    {
+        return *object->locationCode;
+    }
+
+    return utils::getDBusPropertyVal<LocationCode>(bus, objPath,
+                                                   LocationCodeIface,
+                                                   "LocationCode");
+}
+
+std::optional<LocationCode>
+    getUnexpandedLocationCode(sdbusplus::bus::bus& bus,
+                              const sdbusplus::message::object_path& objPath)
+{
+    auto object = getInventoryObject(bus, objPath);
+    if ((object == nullptr) || !object->locationCode.has_value())
+    {
+        return devtree::getUnexpandedLocCode(getLocationCode(bus, objPath));
+    }
+
+    if (!object->unexpandedLocCode.has_value())
+    {
+        object->unexpandedLocCode =
+            devtree::getUnexpandedLocCode(*object->locationCode);
+    }
+    return *object->unexpandedLocCode;
+}
+
+bool isFunctional(sdbusplus::bus::bus& bus,
+                  const sdbusplus::message::object_path& objPath)
+{
+    auto object = getInventoryObject(bus, objPath);
+    if ((object != nullptr) && object->functional.has_value())
+    {
+        return *object->functional;
+    }
+
+    return utils::getDBusPropertyVal<bool>(bus, objPath,
+                                           OperationalStatusIface,
+                                           "Functional");
+}
+
+} // namespace inventory
+} // namespace hw_isolation
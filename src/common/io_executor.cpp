@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/io_executor.hpp"
+
+#include "common/common_types.hpp"
+
+#include <fmt/format.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace io
+{
+
+using namespace phosphor::logging;
+
+/**
+ * @class Executor
+ *
+ * @brief The single worker thread to run the submitted jobs in the order
+ */
+class Executor
+{
+  public:
+    Executor() = delete;
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+    Executor(Executor&&) = delete;
+    Executor& operator=(Executor&&) = delete;
+
+    /**
+     * @brief Constructor to start the worker thread
+     *
+     * @param[in] eventLoop - The event loop to invoke the job completion
+     */
+    explicit Executor(const sdeventplus::Event& eventLoop);
+
+    /** @brief Run the pending jobs and stop the worker thread */
+    ~Executor();
+
+    /**
+     * @brief Used to add the job into the pending jobs
+     *
+     * @param[in] job - The job to run
+     * @param[in] completion - The callback to invoke once the job is done
+     *
+     * @return NULL
+     */
+    void submit(Job&& job, Completion&& completion);
+
+  private:
+    /**
+     * @brief The eventfd to notify the job completion
+     */
+    int _completionFd{-1};
+
+    /**
+     * @brief The event source of the eventfd
+     */
+    sd_event_source* _completionSource{nullptr};
+
+    /**
+     * @brief Used to protect the below members which are shared between
+     *        the sd_event loop and the worker thread.
+     */
+    std::mutex _mutex;
+
+    /**
+     * @brief Used to wake up the worker thread
+     */
+    std::condition_variable _jobAvailable;
+
+    /**
+     * @brief The jobs which are waiting to run
+     */
+    std::deque<std::pair<Job, Completion>> _pendingJobs;
+
+    /**
+     * @brief The completion of the jobs which are done
+     */
+    std::vector<Completion> _completedJobs;
+
+    /**
+     * @brief Used to stop the worker thread
+     */
+    bool _stop{false};
+
+    /**
+     * @brief The worker thread
+     */
+    std::thread _worker;
+
+    /**
+     * @brief The worker thread loop to run the pending jobs
+     *
+     * @return NULL
+     */
+    void runJobs();
+
+    /**
+     * @brief Used to invoke the completion of the done jobs
+     *
+     * @return NULL
+     */
+    void completeJobs();
+
+    /**
+     * @brief The sd-event callback of the eventfd
+     */
+    static int onJobsCompleted(sd_event_source* source, int fd,
+                               uint32_t revents, void* userData);
+};
+
+Executor::Executor(const sdeventplus::Event& eventLoop) :
+    _completionFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    if (_completionFd < 0)
+    {
+        log<level::ERR>(fmt::format("eventfd call failed with ErrNo[{}] "
+                                    "ErrMsg[{}]",
+                                    errno, strerror(errno))
+                            .c_str());
+        throw type::CommonError::InternalFailure();
+    }
+
+    auto rc = sd_event_add_io(eventLoop.get(), &_completionSource,
+                              _completionFd, EPOLLIN, onJobsCompleted, this);
+    if (rc < 0)
+    {
+        log<level::ERR>(fmt::format("sd_event_add_io call failed with "
+                                    "ErrNo[{}] ErrMsg[{}]",
+                                    -rc, strerror(-rc))
+                            .c_str());
+        close(_completionFd);
+        throw type::CommonError::InternalFailure();
+    }
+
+    _worker = std::thread(&Executor::runJobs, this);
+}
+
+Executor::~Executor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _jobAvailable.notify_one();
+    _worker.join();
+
+    sd_event_source_unref(_completionSource);
+    close(_completionFd);
+}
+
+void Executor::submit(Job&& job, Completion&& completion)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingJobs.emplace_back(std::move(job), std::move(completion));
+    }
+    _jobAvailable.notify_one();
+}
+
+void Executor::runJobs()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _jobAvailable.wait(lock,
+                           [this]() { return _stop || !_pendingJobs.empty(); });
+        if (_pendingJobs.empty())
+        {
+            // Stop only after running all the pending jobs.
+            return;
+        }
+
+        auto [job, completion] = std::move(_pendingJobs.front());
+        _pendingJobs.pop_front();
+        lock.unlock();
+
+        try
+        {
+            job();
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(
+                fmt::format("Exception [{}] in the I/O job", e.what())
+                    .c_str());
+        }
+
+        lock.lock();
+        if (completion)
+        {
+            _completedJobs.emplace_back(std::move(completion));
+
+            uint64_t count{1};
+            if (write(_completionFd, &count, sizeof(count)) < 0)
+            {
+                log<level::ERR>(
+                    fmt::format("Failed to notify the I/O job completion "
+                                "with ErrNo[{}] ErrMsg[{}]",
+                                errno, strerror(errno))
+                        .c_str());
+            }
+        }
+    }
+}
+
+void Executor::completeJobs()
+{
+    uint64_t count;
+    while (read(_completionFd, &count, sizeof(count)) > 0)
+    {}
+
+    std::vector<Completion> completedJobs;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        completedJobs.swap(_completedJobs);
+    }
+
+    for (auto& completion : completedJobs)
+    {
+        try
+        {
+            completion();
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(
+                fmt::format("Exception [{}] in the I/O job completion",
+                            e.what())
+                    .c_str());
+        }
+    }
+}
+
+int Executor::onJobsCompleted(sd_event_source* /*source*/, int /*fd*/,
+                              uint32_t /*revents*/, void* userData)
+{
+    static_cast<Executor*>(userData)->completeJobs();
+    return 0;
+}
+
+/**
+ * @brief The I/O executor
+ */
+static std::unique_ptr<Executor> executor;
+
+void initExecutor(const sdeventplus::Event& eventLoop)
+{
+    executor = std::make_unique<Executor>(eventLoop);
+}
+
+void shutdownExecutor()
+{
+    executor.reset();
+}
+
+void submit(Job job, Completion completion)
+{
+    if (executor)
+    {
+        executor->submit(std::move(job), std::move(completion));
+        return;
+    }
+
+    try
+    {
+        job();
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] in the I/O job", e.what()).c_str());
+    }
+
+    if (completion)
+    {
+        completion();
+    }
+}
+
+} // namespace io
+} // namespace hw_isolation
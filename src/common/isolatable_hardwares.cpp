@@ -2,12 +2,22 @@
 
 #include "common/isolatable_hardwares.hpp"
 
+#include "common/inventory_model.hpp"
+#include "common/resolution_cache.hpp"
 #include "common/utils.hpp"
 
 #include <fmt/format.h>
 
 #include <phosphor-logging/elog-errors.hpp>
 
+#include <sdbusplus/bus/match.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
 namespace hw_isolation
 {
 using namespace phosphor::logging;
@@ -17,221 +27,608 @@ namespace isolatable_hws
 
 constexpr auto CommonInventoryItemIface = "xyz.openbmc_project.Inventory.Item";
 
-IsolatableHWs::IsolatableHWs(sdbusplus::bus::bus& bus) : _bus(bus)
-{
+using HwId = IsolatableHWs::HW_Details::HwId;
+using HwDetails = IsolatableHWs::HW_Details;
+using IsolatableHW = std::pair<HwId, HwDetails>;
+
+/**
+ * @brief HwId consists with below ids.
+ *
+ * 1 - The inventory item interface name
+ * 2 - The pdbg class name
+ */
+// The below HwIds will be used to many units as parent fru
+// so creating one object which can reuse.
+constexpr HwId processorHwId("xyz.openbmc_project.Inventory.Item.Cpu", "proc");
+constexpr HwId dimmHwId("xyz.openbmc_project.Inventory.Item.Dimm", "dimm");
+constexpr HwId emptyHwId("", "");
+constexpr bool ItIsFRU = true;
+
+/**
+ * @brief The list of isolatable hardwares
+ *
+ * @note If more than one hardware has the same lookup name then,
+ *       the hardware which has the greater pdbg class name will be used
+ *       and the hardware which is defined first if the pdbg class name
+ *       is also same (refer buildNameIndex()).
+ */
+constexpr std::array isolatableHWsList{
+    // FRU (Field Replaceable Unit) which are present in
+    // OpenPOWER based system
+
+    IsolatableHW{processorHwId,
+                 HwDetails(ItIsFRU, emptyHwId,
+                           devtree::lookup_func::mruId,
+                           inv_path_lookup_func::itemInstanceId,
+                           "")},
+
+    IsolatableHW{dimmHwId,
+                 HwDetails(ItIsFRU, emptyHwId,
+                           devtree::lookup_func::locationCode,
+                           inv_path_lookup_func::itemLocationCode,
+                           "")},
+
+    IsolatableHW{HwId("xyz.openbmc_project.Inventory.Item.Tpm", "tpm"),
+                 HwDetails(ItIsFRU, emptyHwId,
+                           devtree::lookup_func::locationCode,
+                           inv_path_lookup_func::itemLocationCode,
+                           "")},
+
+    // Processor Subunits
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "eq"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Quad")},
+
+    // In BMC inventory, Core and FC representing as
+    // "Inventory.Item.CpuCore" since both are core and it will model based
+    // on the system core mode.
+    IsolatableHW{HwId("xyz.openbmc_project.Inventory.Item.CpuCore", "fc"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemInstanceId,
+                           "")},
+
+    IsolatableHW{HwId("xyz.openbmc_project.Inventory.Item.CpuCore", "core"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemInstanceId,
+                           "")},
+
+    // In BMC inventory, ECO mode core is modeled as a subunit since it
+    // is not the normal core
+    IsolatableHW{HwId(CommonInventoryItemIface, "core"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Cache-Only Core")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "mc"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Memory Controller")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "mi"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Processor To Memory Buffer Interface")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "mcc"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Memory Controller Channel")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "omi"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "OpenCAPI Memory Interface")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "pauc"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "POWER Accelerator Unit Controller")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "pau"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "POWER Accelerator Unit")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "omic"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "OpenCAPI Memory Interface Controller")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "iohs"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "High speed SMP/OpenCAPI Link")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "smpgroup"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "OBUS End Point")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "pec"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "PCI Express controllers")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "phb"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "PCIe host bridge (PHB)")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "nmmu"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::chipUnitPos,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Nest Memory Management Unit")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "nx"),
+                 HwDetails(!ItIsFRU, processorHwId,
+                           devtree::lookup_func::mruId,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Accelerator")},
+
+    // Memory (aka DIMM) subunits
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "ocmb"),
+                 HwDetails(!ItIsFRU, dimmHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemPrettyName,
+                           "OpenCAPI Memory Buffer")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "mem_port"),
+                 HwDetails(!ItIsFRU, dimmHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemPrettyName,
+                           "DDR Memory Port")},
+
+    // ADC and GPIO Expander are Generic I2C Device
+    IsolatableHW{HwId(CommonInventoryItemIface, "adc"),
+                 HwDetails(!ItIsFRU, dimmHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Onboard Memory Power Control Device")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "gpio_expander"),
+                 HwDetails(!ItIsFRU, dimmHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Onboard Memory Power Control Device")},
+
+    IsolatableHW{HwId(CommonInventoryItemIface, "pmic"),
+                 HwDetails(!ItIsFRU, dimmHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Onboard Memory Power Management IC")},
+
+    // Motherboard subunits
+
     /**
-     * @brief HwId consists with below ids.
-     *
-     * 1 - The inventory item interface name
-     * 2 - The pdbg class name
+     * The oscrefclk parent fru is not modelled in the phal cec device tree
+     * so using the temporary workaround (refer getClkParentFruObjPath())
+     * instead of defining the isolatable hardwares list.
      */
-    // The below HwIds will be used to many units as parent fru
-    // so creating one object which can reuse.
-    IsolatableHWs::HW_Details::HwId processorHwId(
-        "xyz.openbmc_project.Inventory.Item.Cpu", "proc");
-    IsolatableHWs::HW_Details::HwId dimmHwId(
-        "xyz.openbmc_project.Inventory.Item.Dimm", "dimm");
-    IsolatableHWs::HW_Details::HwId emptyHwId("", "");
-    bool ItIsFRU = true;
-
-    _isolatableHWsList = {
-        // FRU (Field Replaceable Unit) which are present in
-        // OpenPOWER based system
-
-        {processorHwId, IsolatableHWs::HW_Details(
-                            ItIsFRU, emptyHwId, devtree::lookup_func::mruId,
-                            inv_path_lookup_func::itemInstanceId, "")},
-
-        {dimmHwId, IsolatableHWs::HW_Details(
-                       ItIsFRU, emptyHwId, devtree::lookup_func::locationCode,
-                       inv_path_lookup_func::itemLocationCode, "")},
-
-        {IsolatableHWs::HW_Details::HwId(
-             "xyz.openbmc_project.Inventory.Item.Tpm", "tpm"),
-         IsolatableHWs::HW_Details(ItIsFRU, emptyHwId,
-                                   devtree::lookup_func::locationCode,
-                                   inv_path_lookup_func::itemLocationCode, "")},
-
-        // Processor Subunits
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "eq"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "Quad")},
-
-        // In BMC inventory, Core and FC representing as
-        // "Inventory.Item.CpuCore" since both are core and it will model based
-        // on the system core mode.
-        {IsolatableHWs::HW_Details::HwId(
-             "xyz.openbmc_project.Inventory.Item.CpuCore", "fc"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::pdbgIndex,
-                                   inv_path_lookup_func::itemInstanceId, "")},
-
-        {IsolatableHWs::HW_Details::HwId(
-             "xyz.openbmc_project.Inventory.Item.CpuCore", "core"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemInstanceId, "")},
-
-        // In BMC inventory, ECO mode core is modeled as a subunit since it
-        // is not the normal core
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "core"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "Cache-Only Core")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "mc"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "Memory Controller")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "mi"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Processor To Memory Buffer Interface")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "mcc"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Memory Controller Channel")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "omi"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "OpenCAPI Memory Interface")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "pauc"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "POWER Accelerator Unit Controller")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "pau"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "POWER Accelerator Unit")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "omic"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "OpenCAPI Memory Interface Controller")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "iohs"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "High speed SMP/OpenCAPI Link")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "smpgroup"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "OBUS End Point")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "pec"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "PCI Express controllers")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "phb"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::chipUnitPos,
-             inv_path_lookup_func::itemPrettyName, "PCIe host bridge (PHB)")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "nmmu"),
-         IsolatableHWs::HW_Details(!ItIsFRU, processorHwId,
-                                   devtree::lookup_func::chipUnitPos,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Nest Memory Management Unit")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "nx"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, processorHwId, devtree::lookup_func::mruId,
-             inv_path_lookup_func::itemPrettyName, "Accelerator")},
-
-        // Memory (aka DIMM) subunits
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "ocmb"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, dimmHwId, devtree::lookup_func::pdbgIndex,
-             inv_path_lookup_func::itemPrettyName, "OpenCAPI Memory Buffer")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "mem_port"),
-         IsolatableHWs::HW_Details(
-             !ItIsFRU, dimmHwId, devtree::lookup_func::pdbgIndex,
-             inv_path_lookup_func::itemPrettyName, "DDR Memory Port")},
-
-        // ADC and GPIO Expander are Generic I2C Device
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "adc"),
-         IsolatableHWs::HW_Details(!ItIsFRU, dimmHwId,
-                                   devtree::lookup_func::pdbgIndex,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Onboard Memory Power Control Device")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface,
-                                         "gpio_expander"),
-         IsolatableHWs::HW_Details(!ItIsFRU, dimmHwId,
-                                   devtree::lookup_func::pdbgIndex,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Onboard Memory Power Control Device")},
-
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "pmic"),
-         IsolatableHWs::HW_Details(!ItIsFRU, dimmHwId,
-                                   devtree::lookup_func::pdbgIndex,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Onboard Memory Power Management IC")},
-
-        // Motherboard subunits
+    IsolatableHW{HwId(CommonInventoryItemIface, "oscrefclk"),
+                 HwDetails(!ItIsFRU, emptyHwId,
+                           devtree::lookup_func::pdbgIndex,
+                           inv_path_lookup_func::itemPrettyName,
+                           "Oscillator Reference Clock")},
+};
+
+namespace lookup_index
+{
+/**
+ * @brief The index to look up the isolatable hardware by using the name
+ *        hash i.e. pair<name hash, isolatable hardware list index>
+ *        which is sorted by the name hash.
+ */
+using NameIndex =
+    std::array<std::pair<uint32_t, size_t>, isolatableHWsList.size()>;
+
+/**
+ * @brief Helper function to get the FNV-1a hash of the given name
+ *
+ * @param[in] name - The name to get hash
+ *
+ * @return The hash of the given name
+ */
+constexpr uint32_t hashName(std::string_view name)
+{
+    uint32_t hash{2166136261U};
+    for (const auto& ch : name)
+    {
+        hash = (hash ^ static_cast<uint8_t>(ch)) * 16777619U;
+    }
+    return hash;
+}
 
-        /**
-         * The oscrefclk parent fru is not modelled in the phal cec device tree
-         * so using the temporary workaround (refer getClkParentFruObjPath())
-         * instead of defining the isolatable hardwares list.
-         */
-        {IsolatableHWs::HW_Details::HwId(CommonInventoryItemIface, "oscrefclk"),
-         IsolatableHWs::HW_Details(!ItIsFRU, emptyHwId,
-                                   devtree::lookup_func::pdbgIndex,
-                                   inv_path_lookup_func::itemPrettyName,
-                                   "Oscillator Reference Clock")},
-    };
+constexpr auto interfaceName = [](const IsolatableHW& hw) {
+    return hw.first._interfaceName._name;
+};
+
+constexpr auto pdbgClassName = [](const IsolatableHW& hw) {
+    return hw.first._pdbgClassName._name;
+};
+
+constexpr auto prettyName = [](const IsolatableHW& hw) {
+    return hw.second._prettyName;
+};
+
+/**
+ * @brief Used to build the name index at compile time
+ *
+ * @param[in] getName - The function to get the name to index
+ *
+ * @return The name index which is sorted by the name hash and
+ *         for the same name, by the pdbg class name in descending order
+ *         and then by the isolatable hardware list index.
+ *
+ * @note The pdbg class name order is used to keep the lookup precedence
+ *       of the hardwares which are having the same name.
+ */
+template <typename GetName>
+constexpr NameIndex buildNameIndex(GetName getName)
+{
+    NameIndex index{};
+    for (size_t i = 0; i < isolatableHWsList.size(); ++i)
+    {
+        index[i] = std::make_pair(hashName(getName(isolatableHWsList[i])), i);
+    }
+    std::sort(index.begin(), index.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.first != rhs.first)
+        {
+            return lhs.first < rhs.first;
+        }
+
+        auto lhsPdbgClass = pdbgClassName(isolatableHWsList[lhs.second]);
+        auto rhsPdbgClass = pdbgClassName(isolatableHWsList[rhs.second]);
+        if (lhsPdbgClass != rhsPdbgClass)
+        {
+            return lhsPdbgClass > rhsPdbgClass;
+        }
+        return lhs.second < rhs.second;
+    });
+    return index;
+}
+
+/**
+ * @brief Used to check the different names are not having the same hash
+ *
+ * @param[in] index - The name index to check
+ * @param[in] getName - The function to get the indexed name
+ *
+ * @return true if the name hash is unique for the different names
+ *         false if not
+ */
+template <typename GetName>
+constexpr bool isPerfectHash(const NameIndex& index, GetName getName)
+{
+    for (size_t i = 1; i < index.size(); ++i)
+    {
+        if ((index[i - 1].first == index[i].first) &&
+            (getName(isolatableHWsList[index[i - 1].second]) !=
+             getName(isolatableHWsList[index[i].second])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr auto byInterfaceName = buildNameIndex(interfaceName);
+constexpr auto byPdbgClassName = buildNameIndex(pdbgClassName);
+constexpr auto byPrettyName = buildNameIndex(prettyName);
+
+static_assert(isPerfectHash(byInterfaceName, interfaceName),
+              "Isolatable hardware interface name hash is not unique");
+static_assert(isPerfectHash(byPdbgClassName, pdbgClassName),
+              "Isolatable hardware pdbg class name hash is not unique");
+static_assert(isPerfectHash(byPrettyName, prettyName),
+              "Isolatable hardware pretty name hash is not unique");
+
+/**
+ * @brief Used to look up the isolatable hardware by using the given name
+ *
+ * @param[in] index - The name index to look up
+ * @param[in] getName - The function to get the indexed name
+ * @param[in] name - The name to look up
+ *
+ * @return The isolatable hardware on success
+ *         Empty optional if not found
+ */
+template <typename GetName>
+std::optional<IsolatableHW> find(const NameIndex& index, GetName getName,
+                                 std::string_view name)
+{
+    if (name.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto hash = hashName(name);
+    auto it = std::lower_bound(
+        index.begin(), index.end(), hash,
+        [](const auto& ele, uint32_t value) { return ele.first < value; });
+
+    if ((it == index.end()) || (it->first != hash) ||
+        (getName(isolatableHWsList[it->second]) != name))
+    {
+        return std::nullopt;
+    }
+    return isolatableHWsList[it->second];
+}
+} // namespace lookup_index
+
+namespace path_cache
+{
+/**
+ * @brief The phal cec device tree generation of the cached
+ *        phal cec device tree targets.
+ */
+static devtree::DevTreeGeneration cachedDevTreeGeneration{0};
+
+/**
+ * @brief The cached parent fru target by using the child target
+ */
+static std::unordered_map<struct pdbg_target*, struct pdbg_target*>
+    parentFruTgts;
+
+/**
+ * @brief The cached parent fru inventory object path by using the
+ *        parent fru target
+ */
+static std::unordered_map<struct pdbg_target*,
+                          sdbusplus::message::object_path>
+    parentFruObjPaths;
+
+/**
+ * @brief The cached inventory object path by using the phal cec device
+ *        tree target and whether the inventory object path is for
+ *        the ECO core.
+ */
+static std::map<std::pair<struct pdbg_target*, bool>,
+                sdbusplus::message::object_path>
+    inventoryPaths;
+
+/**
+ * @brief The cached phal cec device tree physical path by using
+ *        the inventory object path.
+ */
+static std::unordered_map<std::string, devtree::DevTreePhysPath>
+    physicalPaths;
+
+/**
+ * @brief The VPD FRUs inventory object paths by using the unexpanded
+ *        location code.
+ *
+ * @note The failed or empty result is cached only until the expiry
+ *       time to avoid the VPD calls storm for the missing FRU.
+ */
+struct FRUsByLocCode
+{
+    std::optional<std::vector<sdbusplus::message::object_path>>
+        inventoryPaths;
+    std::optional<std::chrono::steady_clock::time_point> expiry;
+};
+
+/**
+ * @brief The cached VPD FRUs inventory object paths by using
+ *        the unexpanded location code.
+ */
+static std::unordered_map<LocationCode, FRUsByLocCode> frusByLocCode;
+
+/**
+ * @brief The list of D-Bus match objects to invalidate the cached
+ *        inventory object paths if the inventory is changed.
+ */
+static std::vector<std::unique_ptr<sdbusplus::bus::match::match>>
+    inventoryChangeWatcher;
+
+/**
+ * @brief Used to invalidate the cached phal cec device tree targets
+ *        if the phal cec device tree is reinitialized.
+ *
+ * @return NULL
+ */
+static void validateCachedDevTreeTgts()
+{
+    auto devTreeGeneration = devtree::getDevTreeGeneration();
+    if (devTreeGeneration != cachedDevTreeGeneration)
+    {
+        // The cached targets are invalid after reinitialized
+        // the phal cec device tree.
+        parentFruTgts.clear();
+        parentFruObjPaths.clear();
+        inventoryPaths.clear();
+        physicalPaths.clear();
+        cachedDevTreeGeneration = devTreeGeneration;
+    }
+}
+
+/**
+ * @brief Used to clear the cached inventory object paths
+ *
+ * @param[in] changedObjPath - The added or removed inventory object path
+ *
+ * @return NULL
+ */
+static void clearCachedInventoryPaths(const std::string& changedObjPath)
+{
+    parentFruObjPaths.clear();
+    inventoryPaths.clear();
+    physicalPaths.clear();
+    frusByLocCode.clear();
+    resolution_cache::invalidate(changedObjPath);
+}
+
+/**
+ * @brief Callback to invalidate the cached VPD FRUs inventory object
+ *        paths if the FRU is changed in the inventory.
+ *
+ * @param[in] message - The PropertiesChanged signal message
+ *
+ * @return NULL
+ *
+ * @note The cached entries which have the changed inventory object
+ *       and all the negative entries (since the missing FRU might
+ *       be added) are dropped.
+ */
+static void onFRUChange(sdbusplus::message::message& message)
+{
+    std::string changedObjPath{message.get_path()};
+
+    std::erase_if(frusByLocCode, [&changedObjPath](const auto& entry) {
+        const auto& frus = entry.second;
+        if (frus.expiry.has_value())
+        {
+            return true;
+        }
+        return std::ranges::any_of(*frus.inventoryPaths,
+                                   [&changedObjPath](const auto& path) {
+                                       return path.str == changedObjPath;
+                                   });
+    });
+
+    // The cached inventory object paths are derived from the VPD FRUs.
+    parentFruObjPaths.clear();
+    inventoryPaths.clear();
+    physicalPaths.clear();
+    resolution_cache::invalidate(changedObjPath);
+}
+
+/**
+ * @brief Used to check whether the inventory object paths can be cached
+ *
+ * @return true if the inventory change is watched to invalidate
+ *         false if not
+ */
+static bool canCacheInventoryPaths()
+{
+    return !inventoryChangeWatcher.empty();
+}
+} // namespace path_cache
+
+void initPathCache(sdbusplus::bus::bus& bus)
+{
+    path_cache::cachedDevTreeGeneration = devtree::getDevTreeGeneration();
+
+    try
+    {
+        namespace sdbusplus_match = sdbusplus::bus::match;
+        constexpr auto InventoryRootPath = "/xyz/openbmc_project/inventory";
+
+        auto clearCache = [](sdbusplus::message::message& message) {
+            sdbusplus::message::object_path changedObjPath;
+            try
+            {
+                message.read(changedObjPath);
+            }
+            catch (const sdbusplus::exception::exception& e)
+            {
+                log<level::ERR>(
+                    fmt::format("Exception [{}] while reading the inventory "
+                                "object path from the [{}] signal",
+                                e.what(), message.get_member())
+                        .c_str());
+                // Consider the whole inventory is changed.
+                changedObjPath = InventoryRootPath;
+            }
+            path_cache::clearCachedInventoryPaths(changedObjPath.str);
+        };
+
+        // The InterfacesAdded and InterfacesRemoved signals are sent by
+        // the object manager which might be any parent of the inventory
+        // (for example, "/") so, use the object path (first argument) to
+        // match the inventory namespace.
+        auto inventoryNamespace = std::string(InventoryRootPath) + "/";
+
+        path_cache::inventoryChangeWatcher.push_back(
+            std::make_unique<sdbusplus_match::match>(
+                bus,
+                sdbusplus_match::rules::interfacesAdded() +
+                    sdbusplus_match::rules::argNpath(0, inventoryNamespace),
+                clearCache));
+
+        path_cache::inventoryChangeWatcher.push_back(
+            std::make_unique<sdbusplus_match::match>(
+                bus,
+                sdbusplus_match::rules::interfacesRemoved() +
+                    sdbusplus_match::rules::argNpath(0, inventoryNamespace),
+                clearCache));
+
+        // The VPD FRUs by the location code might be changed if the FRU
+        // is replaced (concurrent maintenance) or VPD is recollected.
+        for (const auto& fruIface :
+             {"xyz.openbmc_project.Inventory.Item",
+              "xyz.openbmc_project.Inventory.Decorator.LocationCode"})
+        {
+            path_cache::inventoryChangeWatcher.push_back(
+                std::make_unique<sdbusplus_match::match>(
+                    bus,
+                    sdbusplus_match::rules::type::signal() +
+                        sdbusplus_match::rules::member("PropertiesChanged") +
+                        sdbusplus_match::rules::interface(
+                            "org.freedesktop.DBus.Properties") +
+                        sdbusplus_match::rules::path_namespace(
+                            InventoryRootPath) +
+                        sdbusplus_match::rules::argN(0, fruIface),
+                    path_cache::onFRUChange));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // The cache can't be invalidated if the inventory is changed
+        // so, don't use the cache.
+        path_cache::inventoryChangeWatcher.clear();
+        log<level::ERR>(
+            fmt::format("Exception [{}] while adding the D-Bus match rules "
+                        "to watch the inventory change",
+                        e.what())
+                .c_str());
+    }
 }
 
+IsolatableHWs::IsolatableHWs(sdbusplus::bus::bus& bus) : _bus(bus) {}
+
 std::optional<
     std::pair<IsolatableHWs::HW_Details::HwId, IsolatableHWs::HW_Details>>
     IsolatableHWs::getIsotableHWDetails(
         const IsolatableHWs::HW_Details::HwId& id) const
 {
-    auto it = std::find_if(
-        _isolatableHWsList.begin(), _isolatableHWsList.end(),
-        [&id](const auto& isolatableHw) { return isolatableHw.first == id; });
-
-    if (it != _isolatableHWsList.end())
+    if (!id._interfaceName._name.empty())
     {
-        return *it;
+        return lookup_index::find(lookup_index::byInterfaceName,
+                                  lookup_index::interfaceName,
+                                  id._interfaceName._name);
     }
-    return std::nullopt;
+
+    return lookup_index::find(lookup_index::byPdbgClassName,
+                              lookup_index::pdbgClassName,
+                              id._pdbgClassName._name);
 }
 
 std::optional<
     std::pair<IsolatableHWs::HW_Details::HwId, IsolatableHWs::HW_Details>>
     IsolatableHWs::getIsolatableHWDetailsByPrettyName(
-        const std::string& prettyName) const
+        std::string_view prettyName) const
 {
-    auto it =
-        std::find_if(_isolatableHWsList.begin(), _isolatableHWsList.end(),
-                     [&prettyName](const auto& isolatableHw) {
-                         return isolatableHw.second._prettyName == prettyName;
-                     });
-
-    if (it != _isolatableHWsList.end())
-    {
-        return *it;
-    }
-    return std::nullopt;
+    return lookup_index::find(lookup_index::byPrettyName,
+                              lookup_index::prettyName, prettyName);
 }
 
 std::optional<
@@ -239,19 +636,11 @@ std::optional<
     IsolatableHWs::getIsotableHWDetailsByObjPath(
         const sdbusplus::message::object_path& dbusObjPath) const
 {
-    std::map<std::string, std::vector<std::string>> objServs;
+    inventory::ObjectServices objServs;
 
     try
     {
-        auto method =
-            _bus.new_method_call(type::ObjectMapperName, type::ObjectMapperPath,
-                                 type::ObjectMapperName, "GetObject");
-
-        method.append(dbusObjPath.str);
-        method.append(std::vector<std::string>({}));
-
-        auto reply = _bus.call(method);
-        reply.read(objServs);
+        objServs = inventory::getObject(_bus, dbusObjPath);
     }
     catch (const sdbusplus::exception::exception& e)
     {
@@ -340,9 +729,7 @@ std::optional<
 LocationCode IsolatableHWs::getLocationCode(
     const sdbusplus::message::object_path& dbusObjPath)
 {
-    return utils::getDBusPropertyVal<LocationCode>(
-        _bus, dbusObjPath,
-        "xyz.openbmc_project.Inventory.Decorator.LocationCode", "LocationCode");
+    return inventory::getLocationCode(_bus, dbusObjPath);
 }
 
 std::optional<sdbusplus::message::object_path>
@@ -361,7 +748,8 @@ std::optional<sdbusplus::message::object_path>
                                  type::ObjectMapperName, "GetAncestors");
 
         method.append(isolateHardware.str);
-        method.append(std::vector<std::string>({parentFruIfaceName._name}));
+        method.append(
+            std::vector<std::string>({std::string(parentFruIfaceName._name)}));
 
         auto reply = _bus.call(method);
         reply.read(parentObjs);
@@ -405,6 +793,15 @@ std::optional<devtree::DevTreePhysPath> IsolatableHWs::getPhysicalPath(
 {
     try
     {
+        path_cache::validateCachedDevTreeTgts();
+
+        auto cachedPhysicalPath =
+            path_cache::physicalPaths.find(isolateHardware.str);
+        if (cachedPhysicalPath != path_cache::physicalPaths.end())
+        {
+            return cachedPhysicalPath->second;
+        }
+
         // Currently the subunit (unitN) is not modeled in the inventory
         // so we cannot locate the right subunit in the CEC device tree.
         if (isolateHardware.filename().starts_with("unit"))
@@ -432,8 +829,9 @@ std::optional<devtree::DevTreePhysPath> IsolatableHWs::getPhysicalPath(
         // Make sure the given isolateHardware inventory path is exist
         // getDBusServiceName() will throw exception if the given object
         // is not exist.
-        utils::getDBusServiceName(_bus, isolateHardware.str,
-                                  isolateHwDetails->first._interfaceName._name);
+        utils::getDBusServiceName(
+            _bus, isolateHardware.str,
+            std::string(isolateHwDetails->first._interfaceName._name));
 
         auto isolateHwInstanceId =
             utils::getInstanceId(isolateHardware.filename());
@@ -442,30 +840,21 @@ std::optional<devtree::DevTreePhysPath> IsolatableHWs::getPhysicalPath(
             return std::nullopt;
         }
 
-        struct pdbg_target* isolateHwTarget;
-        devtree::lookup_func::CanGetPhysPath canGetPhysPath{false};
+        std::optional<struct pdbg_target*> isolateHwTarget;
 
         if (isolateHwDetails->second._isItFRU)
         {
-            auto unExpandedLocCode{devtree::getUnexpandedLocCode(
-                getLocationCode(isolateHardware))};
+            auto unExpandedLocCode{
+                inventory::getUnexpandedLocationCode(_bus, isolateHardware)};
             if (!unExpandedLocCode.has_value())
             {
                 return std::nullopt;
             }
 
-            pdbg_for_each_class_target(
-                isolateHwDetails->first._pdbgClassName._name.c_str(),
-                isolateHwTarget)
-            {
-                canGetPhysPath = isolateHwDetails->second._physPathFuncLookUp(
-                    isolateHwTarget, *isolateHwInstanceId, *unExpandedLocCode);
-
-                if (canGetPhysPath)
-                {
-                    break;
-                }
-            }
+            isolateHwTarget = devtree::getTgtByInstId(
+                std::string(isolateHwDetails->first._pdbgClassName._name),
+                *isolateHwInstanceId, *unExpandedLocCode,
+                isolateHwDetails->second._physPathFuncLookUp);
         }
         else
         {
@@ -497,54 +886,35 @@ std::optional<devtree::DevTreePhysPath> IsolatableHWs::getPhysicalPath(
                 return std::nullopt;
             }
 
-            auto unExpandedLocCode{devtree::getUnexpandedLocCode(
-                getLocationCode(*parentFruObjPath))};
+            auto unExpandedLocCode{
+                inventory::getUnexpandedLocationCode(_bus, *parentFruObjPath)};
             if (!unExpandedLocCode.has_value())
             {
                 return std::nullopt;
             }
 
-            struct pdbg_target* parentFruTarget;
+            auto parentFruTargets = devtree::getTgtsByInstId(
+                std::string(parentFruHwDetails->first._pdbgClassName._name),
+                *parentFruInstanceId, *unExpandedLocCode,
+                parentFruHwDetails->second._physPathFuncLookUp);
 
-            pdbg_for_each_class_target(
-                parentFruHwDetails->first._pdbgClassName._name.c_str(),
-                parentFruTarget)
+            // Check the other matched parents if the isolate hardware is
+            // not found under the parent.
+            for (const auto& parentFruTarget : parentFruTargets)
             {
-                canGetPhysPath = parentFruHwDetails->second._physPathFuncLookUp(
-                    parentFruTarget, *parentFruInstanceId, *unExpandedLocCode);
-
-                if (!canGetPhysPath)
-                {
-                    continue;
-                }
-
-                pdbg_for_each_target(
-                    isolateHwDetails->first._pdbgClassName._name.c_str(),
-                    parentFruTarget, isolateHwTarget)
-                {
-                    canGetPhysPath =
-                        isolateHwDetails->second._physPathFuncLookUp(
-                            isolateHwTarget, *isolateHwInstanceId,
-                            *unExpandedLocCode);
-
-                    if (canGetPhysPath)
-                    {
-                        break;
-                    }
-                }
-
-                // No use to check other parent, since it will enter here
-                // if identified the parent or,
-                // if found the isolate hardware to get physical path or,
-                // if not found the isolate hardware to get physical path
-                if (canGetPhysPath)
+                isolateHwTarget = devtree::getTgtByInstId(
+                    std::string(isolateHwDetails->first._pdbgClassName._name),
+                    *isolateHwInstanceId, *unExpandedLocCode,
+                    isolateHwDetails->second._physPathFuncLookUp,
+                    parentFruTarget);
+                if (isolateHwTarget.has_value())
                 {
                     break;
                 }
             }
         }
 
-        if (!canGetPhysPath)
+        if (!isolateHwTarget.has_value())
         {
             log<level::ERR>(fmt::format("Given hardware [{}] is not found "
                                         " in phal cec device tree",
@@ -553,7 +923,13 @@ std::optional<devtree::DevTreePhysPath> IsolatableHWs::getPhysicalPath(
             return std::nullopt;
         }
 
-        return devtree::getPhysicalPath(isolateHwTarget);
+        auto physicalPath = devtree::getPhysicalPath(*isolateHwTarget);
+        if (path_cache::canCacheInventoryPaths())
+        {
+            path_cache::physicalPaths.emplace(isolateHardware.str,
+                                              physicalPath);
+        }
+        return physicalPath;
     }
     catch (const std::exception& e)
     {
@@ -569,6 +945,40 @@ std::optional<std::vector<sdbusplus::message::object_path>>
     constexpr auto vpdMgrObjPath = "/com/ibm/VPD/Manager";
     constexpr auto vpdInterface = "com.ibm.VPD.Manager";
 
+    // The time to keep the failed or empty result to avoid asking VPD
+    // for the missing FRU again and again (for example, restore).
+    static constexpr auto negativeEntryTTL = std::chrono::seconds(10);
+
+    auto cachedFRUs = path_cache::frusByLocCode.find(unexpandedLocCode);
+    if (cachedFRUs != path_cache::frusByLocCode.end())
+    {
+        if (!cachedFRUs->second.expiry.has_value() ||
+            (std::chrono::steady_clock::now() < *cachedFRUs->second.expiry))
+        {
+            return cachedFRUs->second.inventoryPaths;
+        }
+        path_cache::frusByLocCode.erase(cachedFRUs);
+    }
+
+    auto cacheFRUs =
+        [&unexpandedLocCode](
+            const std::optional<std::vector<sdbusplus::message::object_path>>&
+                inventoryPaths) {
+            if (!path_cache::canCacheInventoryPaths())
+            {
+                return;
+            }
+
+            path_cache::FRUsByLocCode frus{inventoryPaths, std::nullopt};
+            if (!inventoryPaths.has_value() || inventoryPaths->empty())
+            {
+                frus.expiry = std::chrono::steady_clock::now() +
+                              negativeEntryTTL;
+            }
+            path_cache::frusByLocCode.insert_or_assign(unexpandedLocCode,
+                                                       std::move(frus));
+        };
+
     std::vector<sdbusplus::message::object_path> listOfInventoryObjPaths;
 
     try
@@ -595,15 +1005,26 @@ std::optional<std::vector<sdbusplus::message::object_path>>
                                     "the given location code [{}]",
                                     e.what(), unexpandedLocCode)
                             .c_str());
+        cacheFRUs(std::nullopt);
         return std::nullopt;
     }
 
+    cacheFRUs(listOfInventoryObjPaths);
     return listOfInventoryObjPaths;
 }
 
 std::optional<struct pdbg_target*>
     IsolatableHWs::getParentFruPhalDevTreeTgt(struct pdbg_target* devTreeTgt)
 {
+    path_cache::validateCachedDevTreeTgts();
+
+    auto cachedParentFruTgt = path_cache::parentFruTgts.find(devTreeTgt);
+    if (cachedParentFruTgt != path_cache::parentFruTgts.end())
+    {
+        return cachedParentFruTgt->second;
+    }
+    auto childTgt = devTreeTgt;
+
     std::string fruUnitDevTreePath{pdbg_target_path(devTreeTgt)};
     std::string fruUnitPdbgClass{pdbg_target_class_name(devTreeTgt)};
 
@@ -681,6 +1102,8 @@ std::optional<struct pdbg_target*>
             return std::nullopt;
         }
     }
+
+    path_cache::parentFruTgts.emplace(childTgt, parentFruTarget);
     return parentFruTarget;
 }
 
@@ -750,7 +1173,7 @@ std::optional<sdbusplus::message::object_path>
 
     constexpr auto MotherboardIface =
         "xyz.openbmc_project.Inventory.Item.Board.Motherboard";
-    auto parentFruPath = utils::getChildsInventoryPath(
+    auto parentFruPath = inventory::getChildsInventoryPath(
         _bus, std::string("/xyz/openbmc_project/inventory"), MotherboardIface);
 
     if (!parentFruPath.has_value())
@@ -823,6 +1246,13 @@ std::optional<sdbusplus::message::object_path>
         return std::nullopt;
     }
 
+    auto cachedParentFruPath =
+        path_cache::parentFruObjPaths.find(*parentFruTgt);
+    if (cachedParentFruPath != path_cache::parentFruObjPaths.end())
+    {
+        return cachedParentFruPath->second;
+    }
+
     std::string parentFruTgtPdbgClass{pdbg_target_class_name(*parentFruTgt)};
     auto parentFruHwId = IsolatableHWs::HW_Details::HwId{
         IsolatableHWs::HW_Details::HwId::PhalPdbgClassName(
@@ -853,14 +1283,59 @@ std::optional<sdbusplus::message::object_path>
         return std::nullopt;
     }
 
+    if (path_cache::canCacheInventoryPaths())
+    {
+        path_cache::parentFruObjPaths.emplace(*parentFruTgt,
+                                              *parentFruPath);
+    }
     return parentFruPath;
 }
 
 std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
     const devtree::DevTreePhysPath& physicalPath, bool& persistedCoreEcoMode)
+{
+    if (!path_cache::canCacheInventoryPaths())
+    {
+        return lookupInventoryPath(physicalPath, persistedCoreEcoMode);
+    }
+
+    resolution_cache::ResolutionKey resolutionKey{physicalPath,
+                                                  persistedCoreEcoMode};
+
+    // Use the persisted inventory path while restoring after the daemon
+    // restart, and it will be confirmed by the live lookup later.
+    if (auto resolution = resolution_cache::getUnconfirmed(resolutionKey);
+        resolution.has_value())
+    {
+        persistedCoreEcoMode = resolution->ecoCore;
+        return sdbusplus::message::object_path(resolution->inventoryPath);
+    }
+
+    auto inventoryPath =
+        lookupInventoryPath(physicalPath, persistedCoreEcoMode);
+    if (inventoryPath.has_value())
+    {
+        resolution_cache::update(
+            resolutionKey,
+            resolution_cache::Resolution{inventoryPath->str,
+                                         persistedCoreEcoMode});
+    }
+    else
+    {
+        resolution_cache::update(resolutionKey, std::nullopt);
+    }
+    return inventoryPath;
+}
+
+std::optional<sdbusplus::message::object_path>
+    IsolatableHWs::lookupInventoryPath(
+        const devtree::DevTreePhysPath& physicalPath,
+        bool& persistedCoreEcoMode)
 {
     try
     {
+        path_cache::validateCachedDevTreeTgts();
+
         auto isolatedHwTgt = devtree::getPhalDevTreeTgt(physicalPath);
         if (!isolatedHwTgt.has_value())
         {
@@ -947,6 +1422,17 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
             return std::nullopt;
         }
 
+        // The ECO core inventory object path is different from the core.
+        auto inventoryPathCacheKey = std::make_pair(
+            *isolatedHwTgt,
+            isolatedHwDetails->second._prettyName == "Cache-Only Core");
+        auto cachedInventoryPath =
+            path_cache::inventoryPaths.find(inventoryPathCacheKey);
+        if (cachedInventoryPath != path_cache::inventoryPaths.end())
+        {
+            return cachedInventoryPath->second;
+        }
+
         sdbusplus::message::object_path isolatedHwInventoryPath;
         if (isolatedHwDetails->second._isItFRU)
         {
@@ -973,9 +1459,9 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
                 return std::nullopt;
             }
 
-            auto childsInventoryPath = utils::getChildsInventoryPath(
+            auto childsInventoryPath = inventory::getChildsInventoryPath(
                 _bus, *parentFruPath,
-                isolatedHwDetails->first._interfaceName._name);
+                std::string(isolatedHwDetails->first._interfaceName._name));
             if (!childsInventoryPath.has_value())
             {
                 return std::nullopt;
@@ -993,7 +1479,8 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
             if (isolatedHwDetails->first._interfaceName._name ==
                 CommonInventoryItemIface)
             {
-                uniqIsolateHwKey = isolatedHwDetails->second._prettyName;
+                uniqIsolateHwKey =
+                    std::string(isolatedHwDetails->second._prettyName);
             }
             else
             {
@@ -1045,6 +1532,12 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
 
             isolatedHwInventoryPath = *isolateHwPath;
         }
+
+        if (path_cache::canCacheInventoryPaths())
+        {
+            path_cache::inventoryPaths.emplace(inventoryPathCacheKey,
+                                               isolatedHwInventoryPath);
+        }
         return isolatedHwInventoryPath;
     }
     catch (const std::exception& e)
@@ -1090,8 +1583,7 @@ IsItIsoHwInvPath itemPrettyName(sdbusplus::bus::bus& bus,
 
     try
     {
-        auto retPrettyName = utils::getDBusPropertyVal<std::string>(
-            bus, objPath, "xyz.openbmc_project.Inventory.Item", "PrettyName");
+        auto retPrettyName = inventory::getPrettyName(bus, objPath);
 
         return retPrettyName == std::get<std::string>(prettyName);
     }
@@ -1118,12 +1610,8 @@ IsItIsoHwInvPath
 
     try
     {
-        auto expandedLocCode = utils::getDBusPropertyVal<std::string>(
-            bus, objPath,
-            "xyz.openbmc_project.Inventory.Decorator.LocationCode",
-            "LocationCode");
-
-        auto unExpandedLocCode{devtree::getUnexpandedLocCode(expandedLocCode)};
+        auto unExpandedLocCode{
+            inventory::getUnexpandedLocationCode(bus, objPath)};
         if (!unExpandedLocCode.has_value())
         {
             return false;
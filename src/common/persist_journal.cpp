@@ -0,0 +1,872 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/persist_journal.hpp"
+
+#include "common/io_executor.hpp"
+
+#include <endian.h>
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace hw_isolation
+{
+namespace journal
+{
+
+using namespace phosphor::logging;
+namespace fs = std::filesystem;
+
+constexpr auto JOURNAL_FILE_NAME = "journal";
+
+// The separate files which were used to persist the objects by the older
+// version (relative to the persistence directory).
+constexpr auto LEGACY_ENTRY_PERSIST_DIR = "record_entry";
+constexpr auto LEGACY_EVENT_PERSIST_DIR = "event";
+constexpr auto LEGACY_HW_STATUS_EVENT_PERSIST_DIR = "event/hw_status";
+constexpr auto LEGACY_ENTRY_MGR_PERSIST_DIR = "record_mgr";
+constexpr auto LEGACY_ECO_CORES_PERSIST_PATH = "record_mgr/eco_cores";
+
+namespace format
+{
+// The journal header, all the values are stored in the little endian.
+// | Magic (4) | Version (4) |
+constexpr uint32_t MAGIC = 0x4a495748; // "HWIJ"
+constexpr uint32_t VERSION = 1;
+constexpr size_t HDR_MAGIC = 0;
+constexpr size_t HDR_VERSION = 4;
+constexpr size_t HDR_SIZE = 8;
+
+// The journal record, the checksum (CRC-32) covers the remaining record.
+// | Checksum (4) | Payload size (4) | Object id (4) | Object kind (1) |
+// | Operation (1) | Reserved (2) | Payload (Payload size) |
+constexpr size_t REC_CHECKSUM = 0;
+constexpr size_t REC_PAYLOAD_SIZE = 4;
+constexpr size_t REC_OBJECT_ID = 8;
+constexpr size_t REC_OBJECT_KIND = 12;
+constexpr size_t REC_OPERATION = 13;
+constexpr size_t REC_HDR_SIZE = 16;
+
+constexpr uint8_t OP_PUT = 1;
+constexpr uint8_t OP_ERASE = 2;
+} // namespace format
+
+// The journal is compacted only if the stale records are more than
+// this size to avoid rewriting the small journal frequently.
+constexpr size_t COMPACTION_MIN_STALE_SIZE = 64 * 1024;
+
+/**
+ * @brief The directory which contains the journal
+ */
+static fs::path persistDir;
+
+/**
+ * @brief The journal file path
+ */
+static fs::path journalPath;
+
+/**
+ * @brief The persisted objects payload by using the object kind and id
+ */
+static std::map<std::pair<ObjectKind, ObjectId>, std::string> persistedObjects;
+
+/**
+ * @brief The journal file descriptor to append the records
+ *
+ * @note It is used only by the I/O executor after initializing the journal.
+ */
+static int journalFd{-1};
+
+/**
+ * @brief The journal file size
+ */
+static size_t journalSize{0};
+
+/**
+ * @brief The size of the records which hold the live objects
+ */
+static size_t liveRecordsSize{0};
+
+/**
+ * @brief Used to indicate whether the journal is initialized
+ */
+static bool journalInitialized{false};
+
+/**
+ * @brief Used to indicate whether the journal is closed at the exit
+ */
+static bool journalClosed{false};
+
+/**
+ * @brief Helper function to compute the CRC-32 (IEEE 802.3) of the given data
+ *
+ * @param[in] data - The data to compute
+ * @param[in] size - The data size
+ *
+ * @return The CRC-32 value
+ */
+static uint32_t computeCRC32(const uint8_t* data, size_t size)
+{
+    uint32_t crc{0xFFFFFFFF};
+    for (size_t idx = 0; idx < size; ++idx)
+    {
+        crc ^= data[idx];
+        for (auto bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0U - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Helper function to read the little endian 32 bit value
+ *
+ * @param[in] data - The data to read
+ *
+ * @return The value in the host endian
+ */
+static uint32_t readLE32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return le32toh(value);
+}
+
+/**
+ * @brief Helper function to write the 32 bit value as the little endian
+ *
+ * @param[in] data - The data to write into
+ * @param[in] value - The value in the host endian
+ *
+ * @return NULL
+ */
+static void writeLE32(uint8_t* data, uint32_t value)
+{
+    value = htole32(value);
+    std::memcpy(data, &value, sizeof(value));
+}
+
+/**
+ * @brief Helper function to get the journal record size of the given payload
+ *
+ * @param[in] payload - The object payload
+ *
+ * @return The record size
+ */
+static size_t getRecordSize(const std::string& payload)
+{
+    return format::REC_HDR_SIZE + payload.size();
+}
+
+/**
+ * @brief Helper function to append the journal record into the given buffer
+ *
+ * @param[in,out] buffer - The buffer to append
+ * @param[in] operation - The record operation
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ * @param[in] payload - The object payload
+ *
+ * @return NULL
+ */
+static void encodeRecord(std::string& buffer, uint8_t operation,
+                         ObjectKind kind, ObjectId id,
+                         const std::string& payload)
+{
+    uint8_t recordHdr[format::REC_HDR_SIZE]{};
+    writeLE32(recordHdr + format::REC_PAYLOAD_SIZE,
+              static_cast<uint32_t>(payload.size()));
+    writeLE32(recordHdr + format::REC_OBJECT_ID, id);
+    recordHdr[format::REC_OBJECT_KIND] = static_cast<uint8_t>(kind);
+    recordHdr[format::REC_OPERATION] = operation;
+
+    auto recordOffset = buffer.size();
+    buffer.append(reinterpret_cast<const char*>(recordHdr), sizeof(recordHdr));
+    buffer.append(payload);
+
+    auto record = reinterpret_cast<uint8_t*>(buffer.data() + recordOffset);
+    writeLE32(record + format::REC_CHECKSUM,
+              computeCRC32(record + format::REC_PAYLOAD_SIZE,
+                           getRecordSize(payload) - format::REC_PAYLOAD_SIZE));
+}
+
+/**
+ * @brief Helper function to write the whole given data into the given file
+ *
+ * @param[in] fd - The file descriptor to write
+ * @param[in] data - The data to write
+ *
+ * @return true on success
+ *         false on failure
+ */
+static bool writeAll(int fd, const std::string& data)
+{
+    size_t written{0};
+    while (written < data.size())
+    {
+        auto ret = write(fd, data.data() + written, data.size() - written);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            log<level::ERR>(
+                fmt::format("Failed to write the persistence journal with "
+                            "ErrNo [{}] and ErrMsg [{}]",
+                            errno, strerror(errno))
+                    .c_str());
+            return false;
+        }
+        written += ret;
+    }
+    return true;
+}
+
+/**
+ * @brief Used to check whether the journal should be compacted
+ *
+ * @return true if the stale records are more than the live objects
+ *         false otherwise
+ */
+static bool isCompactionRequired()
+{
+    auto staleRecordsSize = journalSize - format::HDR_SIZE - liveRecordsSize;
+    return (staleRecordsSize > COMPACTION_MIN_STALE_SIZE) &&
+           (staleRecordsSize > liveRecordsSize);
+}
+
+/**
+ * @brief Used to create the journal image with only the live objects
+ *
+ * @return The journal image
+ */
+static std::string buildJournalImage()
+{
+    std::string image;
+    image.reserve(format::HDR_SIZE + liveRecordsSize);
+
+    uint8_t journalHdr[format::HDR_SIZE]{};
+    writeLE32(journalHdr + format::HDR_MAGIC, format::MAGIC);
+    writeLE32(journalHdr + format::HDR_VERSION, format::VERSION);
+    image.append(reinterpret_cast<const char*>(journalHdr),
+                 sizeof(journalHdr));
+
+    for (const auto& [key, payload] : persistedObjects)
+    {
+        encodeRecord(image, format::OP_PUT, key.first, key.second, payload);
+    }
+    return image;
+}
+
+/**
+ * @brief Used to replace the journal with the given journal image
+ *
+ * @details The new journal is written into the temporary file and renamed
+ *          to replace the journal so, the journal is always consistent
+ *          even if failed in the middle.
+ *
+ * @param[in] image - The journal image
+ *
+ * @return true on success
+ *         false on failure
+ *
+ * @note The journal won't be appended until replaced successfully if
+ *       failed since the journal might not have the live objects.
+ */
+static bool writeJournalImage(const std::string& image)
+{
+    if (journalFd >= 0)
+    {
+        close(journalFd);
+        journalFd = -1;
+    }
+
+    auto tmpPath = fs::path(journalPath).replace_extension(".tmp");
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+    if (fd < 0)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to create the persistence journal [{}] "
+                        "with ErrNo [{}] and ErrMsg [{}]",
+                        tmpPath.string(), errno, strerror(errno))
+                .c_str());
+        return false;
+    }
+
+    // The journal must be on the storage before replacing the old journal.
+    if (!writeAll(fd, image) || (fsync(fd) < 0))
+    {
+        close(fd);
+        std::error_code ec;
+        fs::remove(tmpPath, ec);
+        return false;
+    }
+    close(fd);
+
+    std::error_code ec;
+    fs::rename(tmpPath, journalPath, ec);
+    if (ec)
+    {
+        log<level::ERR>(fmt::format("Failed to replace the persistence "
+                                    "journal with the error [{}]",
+                                    ec.message())
+                            .c_str());
+        fs::remove(tmpPath, ec);
+        return false;
+    }
+
+    journalFd = open(journalPath.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (journalFd < 0)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to open the persistence journal with "
+                        "ErrNo [{}] and ErrMsg [{}]",
+                        errno, strerror(errno))
+                .c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief The journal write which is waiting to run in the I/O executor
+ */
+struct JournalWrite
+{
+    // true to replace the journal with the data (journal image), false to
+    // append the data (records) into the journal.
+    bool replace{false};
+    std::string data;
+};
+
+/**
+ * @brief Used to protect the below members which are shared with the I/O
+ *        executor worker thread.
+ */
+static std::mutex pendingWritesMutex;
+
+/**
+ * @brief The journal writes which are waiting to run in the order
+ */
+static std::deque<JournalWrite> pendingWrites;
+
+/**
+ * @brief Used to indicate whether the job to run the pending journal
+ *        writes is submitted already.
+ */
+static bool writeJobSubmitted{false};
+
+/**
+ * @brief Used to indicate whether failed to append the records, and
+ *        the journal should be replaced with the live objects.
+ */
+static std::atomic<bool> appendFailed{false};
+
+/**
+ * @brief The I/O executor job to run the pending journal writes
+ *
+ * @details All the records which are added while the previous writes are
+ *          in progress are appended by using the single write (group
+ *          commit).
+ *
+ * @return NULL
+ */
+static void runPendingWrites()
+{
+    std::deque<JournalWrite> writes;
+    {
+        std::lock_guard<std::mutex> lock(pendingWritesMutex);
+        writes.swap(pendingWrites);
+        writeJobSubmitted = false;
+    }
+
+    for (const auto& journalWrite : writes)
+    {
+        if (journalWrite.replace)
+        {
+            writeJournalImage(journalWrite.data);
+        }
+        else if ((journalFd < 0) || !writeAll(journalFd, journalWrite.data))
+        {
+            // The partial records might be appended so, don't append
+            // the next records until the journal is replaced.
+            if (journalFd >= 0)
+            {
+                close(journalFd);
+                journalFd = -1;
+            }
+            appendFailed = true;
+        }
+    }
+}
+
+static void compactJournal();
+
+/**
+ * @brief The I/O executor job completion of the pending journal writes
+ *
+ * @return NULL
+ */
+static void onPendingWritesCompleted()
+{
+    if (appendFailed.exchange(false))
+    {
+        // The in-memory objects have all the changes which are failed
+        // to append.
+        compactJournal();
+    }
+}
+
+/**
+ * @brief Used to add the journal write to run in the I/O executor
+ *
+ * @param[in] replace - true to replace the journal, false to append
+ * @param[in] data - The journal image or records to write
+ *
+ * @return NULL
+ */
+static void queueJournalWrite(bool replace, std::string&& data)
+{
+    bool submitJob{false};
+    {
+        std::lock_guard<std::mutex> lock(pendingWritesMutex);
+        if (replace)
+        {
+            // The journal image has all the changes that are not written.
+            pendingWrites.clear();
+        }
+
+        if (!replace && !pendingWrites.empty() &&
+            !pendingWrites.back().replace)
+        {
+            pendingWrites.back().data.append(data);
+        }
+        else
+        {
+            pendingWrites.emplace_back(JournalWrite{replace, std::move(data)});
+        }
+
+        if (!writeJobSubmitted)
+        {
+            writeJobSubmitted = submitJob = true;
+        }
+    }
+
+    if (submitJob)
+    {
+        io::submit(runPendingWrites, onPendingWritesCompleted);
+    }
+}
+
+/**
+ * @brief Used to rewrite the journal with only the live objects in
+ *        the I/O executor
+ *
+ * @return NULL
+ */
+static void compactJournal()
+{
+    auto image = buildJournalImage();
+    journalSize = image.size();
+    liveRecordsSize = journalSize - format::HDR_SIZE;
+    queueJournalWrite(true, std::move(image));
+}
+
+/**
+ * @brief Used to rewrite the journal with only the live objects in
+ *        the caller thread
+ *
+ * @return true on success
+ *         false on failure
+ *
+ * @note This should be used only while initializing the journal.
+ */
+static bool rewriteJournal()
+{
+    auto image = buildJournalImage();
+    journalSize = image.size();
+    liveRecordsSize = journalSize - format::HDR_SIZE;
+    return writeJournalImage(image);
+}
+
+/**
+ * @brief Used to append the journal record for the given object change
+ *        in the I/O executor
+ *
+ * @param[in] operation - The record operation
+ * @param[in] kind - The object kind
+ * @param[in] id - The object id
+ * @param[in] payload - The object payload
+ *
+ * @return NULL
+ *
+ * @note The journal is compacted if the stale records are more than
+ *       the live objects.
+ */
+static void appendRecord(uint8_t operation, ObjectKind kind, ObjectId id,
+                         const std::string& payload)
+{
+    std::string record;
+    record.reserve(getRecordSize(payload));
+    encodeRecord(record, operation, kind, id, payload);
+    journalSize += record.size();
+    queueJournalWrite(false, std::move(record));
+
+    if (isCompactionRequired())
+    {
+        compactJournal();
+    }
+}
+
+/**
+ * @brief Used to replay the given journal image into the in-memory objects
+ *
+ * @param[in] image - The journal content
+ *
+ * @return true if all the records are replayed
+ *         false if the journal has the invalid records (for example,
+ *         partially appended record due to the power loss) and the records
+ *         from the first invalid record are ignored.
+ */
+static bool replayJournal(const std::vector<uint8_t>& image)
+{
+    size_t offset{format::HDR_SIZE};
+    while (offset < image.size())
+    {
+        auto record = image.data() + offset;
+        auto remainingSize = image.size() - offset;
+        if (remainingSize < format::REC_HDR_SIZE)
+        {
+            break;
+        }
+
+        size_t payloadSize = readLE32(record + format::REC_PAYLOAD_SIZE);
+        if (payloadSize > (remainingSize - format::REC_HDR_SIZE))
+        {
+            break;
+        }
+
+        auto recordSize = format::REC_HDR_SIZE + payloadSize;
+        if (readLE32(record + format::REC_CHECKSUM) !=
+            computeCRC32(record + format::REC_PAYLOAD_SIZE,
+                         recordSize - format::REC_PAYLOAD_SIZE))
+        {
+            break;
+        }
+
+        auto kind = record[format::REC_OBJECT_KIND];
+        if ((kind < static_cast<uint8_t>(ObjectKind::Entry)) ||
+            (kind > static_cast<uint8_t>(ObjectKind::ResolutionCache)))
+        {
+            break;
+        }
+
+        auto key = std::make_pair(static_cast<ObjectKind>(kind),
+                                  readLE32(record + format::REC_OBJECT_ID));
+        auto operation = record[format::REC_OPERATION];
+        if (operation == format::OP_PUT)
+        {
+            auto payload = reinterpret_cast<const char*>(
+                record + format::REC_HDR_SIZE);
+            persistedObjects.insert_or_assign(
+                key, std::string(payload, payloadSize));
+        }
+        else if (operation == format::OP_ERASE)
+        {
+            persistedObjects.erase(key);
+        }
+        else
+        {
+            break;
+        }
+
+        offset += recordSize;
+    }
+
+    journalSize = offset;
+    liveRecordsSize = 0;
+    for (const auto& [key, payload] : persistedObjects)
+    {
+        liveRecordsSize += getRecordSize(payload);
+    }
+
+    return offset == image.size();
+}
+
+/**
+ * @brief Used to import the objects from the given directory which
+ *        were persisted in the separate files by the older version
+ *
+ * @param[in] kind - The object kind
+ * @param[in] dir - The directory which contains the objects file by using
+ *                  the object id as the file name.
+ *
+ * @return NULL
+ */
+static void importLegacyObjects(ObjectKind kind, const fs::path& dir)
+{
+    std::error_code ec;
+    for (const auto& file : fs::directory_iterator(dir, ec))
+    {
+        if (!file.is_regular_file())
+        {
+            continue;
+        }
+
+        ObjectId id;
+        try
+        {
+            id = std::stoul(file.path().filename());
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+
+        std::ifstream is(file.path(), std::ios::in | std::ios::binary);
+        persistedObjects.insert_or_assign(
+            std::make_pair(kind, id),
+            std::string(std::istreambuf_iterator<char>(is),
+                        std::istreambuf_iterator<char>()));
+    }
+}
+
+/**
+ * @brief Used to create the journal with the objects which were persisted
+ *        in the separate files by the older version
+ *
+ * @return NULL
+ */
+static void migrateLegacyObjects()
+{
+    importLegacyObjects(ObjectKind::Entry,
+                        persistDir / LEGACY_ENTRY_PERSIST_DIR);
+    importLegacyObjects(ObjectKind::Event,
+                        persistDir / LEGACY_HW_STATUS_EVENT_PERSIST_DIR);
+
+    auto ecoCoresPath = persistDir / LEGACY_ECO_CORES_PERSIST_PATH;
+    if (fs::exists(ecoCoresPath))
+    {
+        std::ifstream is(ecoCoresPath, std::ios::in | std::ios::binary);
+        persistedObjects.insert_or_assign(
+            std::make_pair(ObjectKind::EcoCores, ObjectId(0)),
+            std::string(std::istreambuf_iterator<char>(is),
+                        std::istreambuf_iterator<char>()));
+    }
+
+    if (!rewriteJournal())
+    {
+        // Keep the older version files to import again.
+        return;
+    }
+
+    std::error_code ec;
+    fs::remove_all(persistDir / LEGACY_ENTRY_PERSIST_DIR, ec);
+    fs::remove_all(persistDir / LEGACY_EVENT_PERSIST_DIR, ec);
+    fs::remove_all(persistDir / LEGACY_ENTRY_MGR_PERSIST_DIR, ec);
+}
+
+/**
+ * @brief Helper function to init the journal in the default directory if
+ *        the journal is not initialized yet
+ *
+ * @return NULL
+ *
+ * @note The closed journal is not initialized again so, the object changes
+ *       at the daemon exit are ignored.
+ */
+static void initDefaultJournal()
+{
+    if (!journalInitialized)
+    {
+        initJournal();
+    }
+}
+
+void initJournal(const fs::path& persistDataDir)
+{
+    if (journalInitialized && !journalClosed)
+    {
+        return;
+    }
+
+    // Drop the objects of the closed journal to initialize again.
+    if (journalFd >= 0)
+    {
+        close(journalFd);
+        journalFd = -1;
+    }
+    persistedObjects.clear();
+    journalSize = liveRecordsSize = 0;
+    appendFailed = false;
+    journalInitialized = true;
+    journalClosed = false;
+
+    persistDir = persistDataDir;
+    journalPath = persistDir / JOURNAL_FILE_NAME;
+
+    std::error_code ec;
+    fs::create_directories(persistDir, ec);
+
+    if (!fs::exists(journalPath))
+    {
+        migrateLegacyObjects();
+        return;
+    }
+
+    // Read the whole journal at once to replay.
+    std::ifstream is(journalPath, std::ios::in | std::ios::binary);
+    std::vector<uint8_t> image(std::istreambuf_iterator<char>(is),
+                               std::istreambuf_iterator<char>{});
+
+    if ((image.size() < format::HDR_SIZE) ||
+        (readLE32(image.data() + format::HDR_MAGIC) != format::MAGIC))
+    {
+        log<level::ERR>("Invalid persistence journal header, "
+                        "creating the new journal");
+        fs::rename(journalPath, fs::path(journalPath).concat(".invalid"), ec);
+        rewriteJournal();
+        return;
+    }
+
+    auto version = readLE32(image.data() + format::HDR_VERSION);
+    if (version != format::VERSION)
+    {
+        // Keep the unsupported journal for the version which created it.
+        log<level::ERR>(fmt::format("Unsupported persistence journal version "
+                                    "[{}], creating the new journal",
+                                    version)
+                            .c_str());
+        fs::rename(journalPath,
+                   fs::path(journalPath).concat(fmt::format(".v{}", version)),
+                   ec);
+        rewriteJournal();
+        return;
+    }
+
+    if (!replayJournal(image))
+    {
+        log<level::ERR>(fmt::format("Ignored the invalid persistence journal "
+                                    "records from the offset [{}]",
+                                    journalSize)
+                            .c_str());
+        rewriteJournal();
+        return;
+    }
+
+    if (isCompactionRequired())
+    {
+        rewriteJournal();
+        return;
+    }
+
+    journalFd = open(journalPath.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (journalFd < 0)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to open the persistence journal with "
+                        "ErrNo [{}] and ErrMsg [{}]",
+                        errno, strerror(errno))
+                .c_str());
+    }
+}
+
+void closeJournal()
+{
+    journalClosed = true;
+}
+
+void put(ObjectKind kind, ObjectId id, std::string&& payload)
+{
+    initDefaultJournal();
+
+    if (journalClosed)
+    {
+        return;
+    }
+
+    auto key = std::make_pair(kind, id);
+    auto object = persistedObjects.find(key);
+    if (object != persistedObjects.end())
+    {
+        if (object->second == payload)
+        {
+            return;
+        }
+        liveRecordsSize -= getRecordSize(object->second);
+        object->second = std::move(payload);
+    }
+    else
+    {
+        object = persistedObjects.emplace(key, std::move(payload)).first;
+    }
+    liveRecordsSize += getRecordSize(object->second);
+
+    appendRecord(format::OP_PUT, kind, id, object->second);
+}
+
+const std::string* get(ObjectKind kind, ObjectId id)
+{
+    initDefaultJournal();
+
+    auto object = persistedObjects.find(std::make_pair(kind, id));
+    if (object == persistedObjects.end())
+    {
+        return nullptr;
+    }
+    return &object->second;
+}
+
+void erase(ObjectKind kind, ObjectId id)
+{
+    initDefaultJournal();
+
+    if (journalClosed)
+    {
+        return;
+    }
+
+    auto object = persistedObjects.find(std::make_pair(kind, id));
+    if (object == persistedObjects.end())
+    {
+        return;
+    }
+    liveRecordsSize -= getRecordSize(object->second);
+    persistedObjects.erase(object);
+
+    appendRecord(format::OP_ERASE, kind, id, std::string());
+}
+
+std::vector<ObjectId> getIds(ObjectKind kind)
+{
+    initDefaultJournal();
+
+    std::vector<ObjectId> ids;
+    auto object =
+        persistedObjects.lower_bound(std::make_pair(kind, ObjectId(0)));
+    for (; (object != persistedObjects.end()) && (object->first.first == kind);
+         ++object)
+    {
+        ids.emplace_back(object->first.second);
+    }
+    return ids;
+}
+
+} // namespace journal
+} // namespace hw_isolation
@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/phal_devtree_blob.hpp"
+
+#include <endian.h>
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace devtree
+{
+
+using namespace phosphor::logging;
+
+namespace fdt
+{
+// The flattened device tree format constants.
+constexpr uint32_t MAGIC = 0xd00dfeed;
+constexpr uint32_t BEGIN_NODE = 0x1;
+constexpr uint32_t END_NODE = 0x2;
+constexpr uint32_t PROP = 0x3;
+constexpr uint32_t NOP = 0x4;
+constexpr uint32_t END = 0x9;
+
+// The flattened device tree header members offset.
+constexpr size_t HDR_MAGIC = 0;
+constexpr size_t HDR_TOTALSIZE = 4;
+constexpr size_t HDR_OFF_DT_STRUCT = 8;
+constexpr size_t HDR_OFF_DT_STRINGS = 12;
+constexpr size_t HDR_SIZE_DT_STRINGS = 32;
+constexpr size_t HDR_SIZE_DT_STRUCT = 36;
+constexpr size_t HDR_SIZE = 40;
+
+constexpr size_t TOKEN_ALIGN = 4;
+} // namespace fdt
+
+/**
+ * @brief Helper function to read the big endian 32 bit value
+ *
+ * @param[in] data - The data to read
+ *
+ * @return The value in the host endian
+ */
+static uint32_t readBE32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return be32toh(value);
+}
+
+/**
+ * @brief Helper function to align the given offset to the token alignment
+ *
+ * @param[in] offset - The offset to align
+ *
+ * @return The aligned offset
+ */
+static size_t alignToToken(size_t offset)
+{
+    return (offset + fdt::TOKEN_ALIGN - 1) & ~(fdt::TOKEN_ALIGN - 1);
+}
+
+DevTreeBlob::DevTreeBlob(const std::filesystem::path& devTreePath)
+{
+    int fd = open(devTreePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to open the phal cec device tree [{}] "
+                        "with ErrNo [{}] and ErrMsg [{}]",
+                        devTreePath.string(), errno, strerror(errno))
+                .c_str());
+        return;
+    }
+
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) < 0) ||
+        (static_cast<size_t>(fileStat.st_size) < fdt::HDR_SIZE))
+    {
+        log<level::ERR>(
+            fmt::format("Invalid phal cec device tree [{}] to map",
+                        devTreePath.string())
+                .c_str());
+        close(fd);
+        return;
+    }
+
+    auto blob =
+        mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping is still valid even after closing the file descriptor.
+    close(fd);
+
+    if (blob == MAP_FAILED)
+    {
+        log<level::ERR>(
+            fmt::format("Failed to map the phal cec device tree [{}] "
+                        "with ErrNo [{}] and ErrMsg [{}]",
+                        devTreePath.string(), errno, strerror(errno))
+                .c_str());
+        return;
+    }
+
+    _blob = static_cast<const uint8_t*>(blob);
+    _blobSize = fileStat.st_size;
+
+    if (!indexNodesPropsOffset())
+    {
+        log<level::ERR>(
+            fmt::format("Invalid phal cec device tree [{}] to index",
+                        devTreePath.string())
+                .c_str());
+        _nodesPropsOffset.clear();
+    }
+}
+
+DevTreeBlob::~DevTreeBlob()
+{
+    if (_blob != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(_blob), _blobSize);
+    }
+}
+
+bool DevTreeBlob::indexNodesPropsOffset()
+{
+    if ((readBE32(_blob + fdt::HDR_MAGIC) != fdt::MAGIC) ||
+        (readBE32(_blob + fdt::HDR_TOTALSIZE) > _blobSize))
+    {
+        return false;
+    }
+
+    // The bounds are checked without adding the blob values since the sum
+    // might wrap around if size_t is 32 bits.
+    size_t structOff = readBE32(_blob + fdt::HDR_OFF_DT_STRUCT);
+    size_t structSize = readBE32(_blob + fdt::HDR_SIZE_DT_STRUCT);
+    size_t stringsOff = readBE32(_blob + fdt::HDR_OFF_DT_STRINGS);
+    size_t stringsSize = readBE32(_blob + fdt::HDR_SIZE_DT_STRINGS);
+
+    if ((structOff > _blobSize) || (structSize > _blobSize - structOff) ||
+        (stringsOff > _blobSize) || (stringsSize > _blobSize - stringsOff))
+    {
+        return false;
+    }
+
+    size_t structEnd = structOff + structSize;
+    size_t stringsEnd = stringsOff + stringsSize;
+
+    // The length of the parent node path to restore while leaving the node.
+    std::vector<size_t> parentPathLen;
+    std::string nodePath;
+
+    size_t offset = structOff;
+    while (offset + sizeof(uint32_t) <= structEnd)
+    {
+        auto token = readBE32(_blob + offset);
+        offset += sizeof(uint32_t);
+
+        switch (token)
+        {
+            case fdt::BEGIN_NODE:
+            {
+                auto name = reinterpret_cast<const char*>(_blob + offset);
+                auto nameLen = strnlen(name, structEnd - offset);
+                if (nameLen >= structEnd - offset)
+                {
+                    return false;
+                }
+
+                parentPathLen.push_back(nodePath.size());
+                if (parentPathLen.size() == 1)
+                {
+                    // The root node name is empty.
+                    nodePath = "/";
+                }
+                else
+                {
+                    if (nodePath.back() != '/')
+                    {
+                        nodePath.push_back('/');
+                    }
+                    nodePath.append(name, nameLen);
+                }
+
+                offset = alignToToken(offset + nameLen + 1);
+                break;
+            }
+            case fdt::END_NODE:
+            {
+                if (parentPathLen.empty())
+                {
+                    return false;
+                }
+                nodePath.resize(parentPathLen.back());
+                parentPathLen.pop_back();
+                break;
+            }
+            case fdt::PROP:
+            {
+                if (structEnd - offset < 2 * sizeof(uint32_t))
+                {
+                    return false;
+                }
+                auto propLen = readBE32(_blob + offset);
+                auto nameOff = readBE32(_blob + offset + sizeof(uint32_t));
+                offset += 2 * sizeof(uint32_t);
+
+                if ((propLen > structEnd - offset) ||
+                    (nameOff >= stringsEnd - stringsOff))
+                {
+                    return false;
+                }
+
+                std::string_view propName(
+                    reinterpret_cast<const char*>(_blob + stringsOff +
+                                                  nameOff),
+                    strnlen(reinterpret_cast<const char*>(_blob + stringsOff +
+                                                          nameOff),
+                            stringsEnd - stringsOff - nameOff));
+
+                PropOffset propOffset{static_cast<uint32_t>(offset), propLen};
+                if (propName == "ATTR_HWAS_STATE")
+                {
+                    _nodesPropsOffset[nodePath].hwasState = propOffset;
+                }
+                else if (propName == "ATTR_PHYS_BIN_PATH")
+                {
+                    _nodesPropsOffset[nodePath].physBinPath = propOffset;
+                }
+
+                offset = alignToToken(offset + propLen);
+                break;
+            }
+            case fdt::NOP:
+                break;
+            case fdt::END:
+                return parentPathLen.empty();
+            default:
+                return false;
+        }
+    }
+
+    return false;
+}
+
+const PropOffset*
+    DevTreeBlob::getPropOffset(std::string_view nodePath,
+                               PropOffset NodePropsOffset::*prop) const
+{
+    auto nodePropsOffset = _nodesPropsOffset.find(nodePath);
+    if ((nodePropsOffset == _nodesPropsOffset.end()) ||
+        ((nodePropsOffset->second.*prop).length == 0))
+    {
+        return nullptr;
+    }
+    return &(nodePropsOffset->second.*prop);
+}
+
+bool DevTreeBlob::getHwasState(std::string_view nodePath,
+                               ATTR_HWAS_STATE_Type& hwasState) const
+{
+    auto propOffset = getPropOffset(nodePath, &NodePropsOffset::hwasState);
+    if (propOffset == nullptr)
+    {
+        return false;
+    }
+
+    // The attribute value is packed as per the attribute spec i.e. each
+    // digit is the size of the respective member in the big endian.
+    std::string_view spec{dtAttr::fapi2::ATTR_HWAS_STATE_Spec};
+    std::vector<uint32_t> members;
+    size_t memberOffset = propOffset->offset;
+    size_t propEnd = propOffset->offset + propOffset->length;
+    for (const auto& memberSize : spec)
+    {
+        size_t size = memberSize - '0';
+        if ((size == 0) || (size > sizeof(uint32_t)) ||
+            (memberOffset + size > propEnd))
+        {
+            return false;
+        }
+
+        uint32_t value{0};
+        for (size_t i = 0; i < size; ++i)
+        {
+            value = (value << 8) | _blob[memberOffset + i];
+        }
+        members.push_back(value);
+        memberOffset += size;
+    }
+
+    // deconfiguredByEid, poweredOn, present and functional
+    constexpr auto requiredMembers = 4;
+    if ((memberOffset != propEnd) || (members.size() < requiredMembers))
+    {
+        return false;
+    }
+
+    hwasState = ATTR_HWAS_STATE_Type{};
+    hwasState.deconfiguredByEid = members[0];
+    hwasState.poweredOn = members[1];
+    hwasState.present = members[2];
+    hwasState.functional = members[3];
+
+    return true;
+}
+
+bool DevTreeBlob::getPhysBinPath(std::string_view nodePath,
+                                 ATTR_PHYS_BIN_PATH_Type& physBinPath) const
+{
+    auto propOffset = getPropOffset(nodePath, &NodePropsOffset::physBinPath);
+    if ((propOffset == nullptr) || (propOffset->length != sizeof(physBinPath)))
+    {
+        return false;
+    }
+
+    std::memcpy(physBinPath, _blob + propOffset->offset, sizeof(physBinPath));
+    return true;
+}
+
+} // namespace devtree
+} // namespace hw_isolation
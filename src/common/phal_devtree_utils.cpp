@@ -16,9 +16,16 @@ extern "C"
 
 #include <phosphor-logging/elog-errors.hpp>
 
+#include <array>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <map>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
 
 namespace hw_isolation
 {
@@ -32,20 +39,411 @@ using namespace phosphor::logging;
  * usage.
  */
 constexpr int continueTgtTraversal = 0;
-constexpr int requireIsolateHwFound = 1;
 
-struct CecDevTreeHw
+/**
+ * @brief The phal cec device tree targets index by using physical path.
+ *
+ * @details The index is built once the phal cec device tree is initialized
+ *          so the isolated hardware target can get without traversing
+ *          the whole cec device tree for every lookup.
+ */
+using PhysPathIndex = std::unordered_map<DevTreePhysPath, struct pdbg_target*,
+                                         DevTreePhysPath::Hash>;
+static PhysPathIndex physPathIndex;
+
+/**
+ * @brief Used to indicate what the instance id of the target is
+ *        for the given lookup function.
+ */
+enum class InstIdKind
 {
-    ATTR_PHYS_BIN_PATH_Type physBinPath;
+    MruId,
+    ChipUnitPos,
+    LocationCode,
+    PdbgIndex
+};
+
+/**
+ * @brief The phal cec device tree targets index by using the lookup scope
+ *        (the parent target or nullptr for the whole cec device tree),
+ *        the unexpanded location code and the instance id.
+ */
+using InstIdIndexKey =
+    std::tuple<struct pdbg_target*, LocationCode, InstanceId>;
+
+/**
+ * @brief The targets which are matched for the same index key
+ *        i.e. pair<traversal order, target> which is sorted by
+ *        the pdbg class targets traversal order.
+ */
+using InstIdIndexTgts = std::vector<std::pair<size_t, struct pdbg_target*>>;
+using InstIdIndex = std::map<InstIdIndexKey, InstIdIndexTgts>;
+
+/**
+ * @brief The instance id indexes for each pdbg class and instance id kind.
+ *
+ * @details The index is built on the first lookup of the respective pdbg
+ *          class and it will be dropped when the phal cec device tree is
+ *          initialized again.
+ */
+static std::map<std::pair<std::string, InstIdKind>, InstIdIndex>
+    instIdIndexes;
+
+/**
+ * @brief The phal cec device tree generation which is changed whenever
+ *        the phal cec device tree is initialized.
+ */
+static DevTreeGeneration devTreeGeneration{0};
+
+/**
+ * @brief The digest of the phal cec device tree blob which is used to
+ *        initialize the phal cec device tree.
+ */
+static std::optional<DevTreeDigest> devTreeDigest;
 
-    struct pdbg_target* reqDevTreeHw;
+/**
+ * @brief Used to indicate the attributes which are kept in the snapshot.
+ */
+enum SnapshotAttr : uint8_t
+{
+    SnapshotHwasState = 1 << 0,
+    SnapshotMruId = 1 << 1,
+    SnapshotChipUnitPos = 1 << 2,
+    SnapshotChipletId = 1 << 3,
+    SnapshotLocationCode = 1 << 4,
+    SnapshotEcoMode = 1 << 5
+};
 
-    CecDevTreeHw()
+/**
+ * @brief The snapshot of the phal cec device tree target attributes which
+ *        are read many times for the same target.
+ *
+ * @details * The targets are indexed by their cec device tree traversal
+ *            order and the attributes are kept in the respective array
+ *            by using the target index.
+ *          * The attribute will be read from the cec device tree only
+ *            once per generation when it is required, and the generation
+ *            is changed when the cec device tree is initialized or
+ *            the snapshot is refreshed.
+ */
+struct AttrSnapshot
+{
+    std::unordered_map<struct pdbg_target*, std::size_t> tgtIndex;
+
+    // The bitmask of SnapshotAttr that are read in the current generation.
+    std::vector<uint8_t> readAttrs;
+
+    // The bitmask of SnapshotAttr that are present in the target.
+    std::vector<uint8_t> presentAttrs;
+
+    std::vector<ATTR_HWAS_STATE_Type> hwasState;
+    std::vector<ATTR_MRU_ID_Type> mruId;
+    std::vector<ATTR_CHIP_UNIT_POS_Type> chipUnitPos;
+    std::vector<ATTR_CHIPLET_ID_Type> chipletId;
+    std::vector<LocationCode> locationCode;
+    std::vector<ATTR_ECO_MODE_Type> ecoMode;
+
+    void addTarget(struct pdbg_target* target)
     {
-        std::memset(&physBinPath, 0, sizeof(physBinPath));
-        reqDevTreeHw = nullptr;
+        if (tgtIndex.emplace(target, tgtIndex.size()).second)
+        {
+            readAttrs.push_back(0);
+            presentAttrs.push_back(0);
+        }
+    }
+
+    void clear()
+    {
+        tgtIndex.clear();
+        readAttrs.clear();
+        presentAttrs.clear();
+        hwasState.clear();
+        mruId.clear();
+        chipUnitPos.clear();
+        chipletId.clear();
+        locationCode.clear();
+        ecoMode.clear();
+    }
+
+    void resize()
+    {
+        hwasState.resize(tgtIndex.size());
+        mruId.resize(tgtIndex.size());
+        chipUnitPos.resize(tgtIndex.size());
+        chipletId.resize(tgtIndex.size());
+        locationCode.resize(tgtIndex.size());
+        ecoMode.resize(tgtIndex.size());
     }
 };
+static AttrSnapshot attrSnapshot;
+
+/**
+ * @brief Helper function to get the attribute value from the snapshot
+ *
+ * @param[in] target - The target to get the attribute value
+ * @param[in] attr - The snapshot attribute
+ * @param[in] values - The snapshot array of the given attribute
+ * @param[out] value - The attribute value
+ * @param[in] readAttr - The function to read the attribute from the cec
+ *                       device tree if it is not read in this generation
+ *
+ * @return true if the attribute is present in the given target
+ *         false otherwise
+ */
+template <typename T, typename ReadAttrFunc>
+bool getSnapshotAttr(struct pdbg_target* target, const SnapshotAttr attr,
+                     std::vector<T>& values, T& value, ReadAttrFunc readAttr)
+{
+    auto it = attrSnapshot.tgtIndex.find(target);
+    if (it == attrSnapshot.tgtIndex.end())
+    {
+        // Should not happen, all targets are indexed in the init path.
+        return readAttr(value);
+    }
+
+    auto tgtIndex = it->second;
+    if (!(attrSnapshot.readAttrs[tgtIndex] & attr))
+    {
+        if (readAttr(values[tgtIndex]))
+        {
+            attrSnapshot.presentAttrs[tgtIndex] |= attr;
+        }
+        else
+        {
+            attrSnapshot.presentAttrs[tgtIndex] &= ~attr;
+        }
+        attrSnapshot.readAttrs[tgtIndex] |= attr;
+    }
+
+    if (!(attrSnapshot.presentAttrs[tgtIndex] & attr))
+    {
+        return false;
+    }
+
+    value = values[tgtIndex];
+    return true;
+}
+
+/**
+ * @brief Used to get the MRU_ID from the snapshot
+ *
+ * @param[in] target - The target to get the attribute value
+ * @param[out] mruId - The attribute value
+ *
+ * @return true if the attribute is present in the given target
+ *         false otherwise
+ *
+ * @note The MRU_ID is not present for all targets so, not using
+ *       "DT_GET_PROP" to avoid the trace if the given attribute is
+ *       not found, and same for other optional attributes.
+ */
+bool getMruId(struct pdbg_target* target, ATTR_MRU_ID_Type& mruId)
+{
+    return getSnapshotAttr(target, SnapshotMruId, attrSnapshot.mruId, mruId,
+                           [target](ATTR_MRU_ID_Type& value) {
+                               return pdbg_target_get_attribute(
+                                   target, "ATTR_MRU_ID",
+                                   std::stoi(dtAttr::fapi2::ATTR_MRU_ID_Spec),
+                                   dtAttr::fapi2::ATTR_MRU_ID_ElementCount,
+                                   &value);
+                           });
+}
+
+/**
+ * @brief Used to get the CHIP_UNIT_POS from the snapshot
+ *
+ * @param[in] target - The target to get the attribute value
+ * @param[out] chipUnitPos - The attribute value
+ *
+ * @return true if the attribute is present in the given target
+ *         false otherwise
+ */
+bool getChipUnitPos(struct pdbg_target* target,
+                    ATTR_CHIP_UNIT_POS_Type& chipUnitPos)
+{
+    return getSnapshotAttr(
+        target, SnapshotChipUnitPos, attrSnapshot.chipUnitPos, chipUnitPos,
+        [target](ATTR_CHIP_UNIT_POS_Type& value) {
+            return pdbg_target_get_attribute(
+                target, "ATTR_CHIP_UNIT_POS",
+                std::stoi(dtAttr::fapi2::ATTR_CHIP_UNIT_POS_Spec),
+                dtAttr::fapi2::ATTR_CHIP_UNIT_POS_ElementCount, &value);
+        });
+}
+
+/**
+ * @brief Used to get the CHIPLET_ID from the snapshot
+ *
+ * @param[in] target - The target to get the attribute value
+ * @param[out] chipletId - The attribute value
+ *
+ * @return true if the attribute is present in the given target
+ *         false otherwise
+ */
+bool getChipletId(struct pdbg_target* target, ATTR_CHIPLET_ID_Type& chipletId)
+{
+    return getSnapshotAttr(
+        target, SnapshotChipletId, attrSnapshot.chipletId, chipletId,
+        [target](ATTR_CHIPLET_ID_Type& value) {
+            return pdbg_target_get_attribute(
+                target, "ATTR_CHIPLET_ID",
+                std::stoi(dtAttr::fapi2::ATTR_CHIPLET_ID_Spec),
+                dtAttr::fapi2::ATTR_CHIPLET_ID_ElementCount, &value);
+        });
+}
+
+/**
+ * @brief Used to get the LOCATION_CODE from the snapshot
+ *
+ * @param[in] target - The target to get the attribute value
+ * @param[out] locCode - The attribute value
+ *
+ * @return true if the attribute is present in the given target
+ *         false otherwise
+ */
+bool getLocationCode(struct pdbg_target* target, LocationCode& locCode)
+{
+    return getSnapshotAttr(
+        target, SnapshotLocationCode, attrSnapshot.locationCode, locCode,
+        [target](LocationCode& value) {
+            ATTR_LOCATION_CODE_Type devTreelocCode;
+            if (!pdbg_target_get_attribute(
+                    target, "ATTR_LOCATION_CODE",
+                    std::stoi(dtAttr::fapi2::ATTR_LOCATION_CODE_Spec),
+                    dtAttr::fapi2::ATTR_LOCATION_CODE_ElementCount,
+                    devTreelocCode))
+            {
+                return false;
+            }
+            value = LocationCode(devTreelocCode);
+            return true;
+        });
+}
+
+/**
+ * @brief Used to get the ECO_MODE from the snapshot
+ *
+ * @param[in] target - The target to get the attribute value
+ * @param[out] ecoMode - The attribute value
+ *
+ * @return true if the attribute is present in the given target
+ *         false otherwise
+ */
+bool getEcoMode(struct pdbg_target* target, ATTR_ECO_MODE_Type& ecoMode)
+{
+    return getSnapshotAttr(target, SnapshotEcoMode, attrSnapshot.ecoMode,
+                           ecoMode, [target](ATTR_ECO_MODE_Type& value) {
+                               return !DT_GET_PROP(ATTR_ECO_MODE, target,
+                                                   value);
+                           });
+}
+
+bool getHwasState(struct pdbg_target* target, ATTR_HWAS_STATE_Type& hwasState)
+{
+    return getSnapshotAttr(target, SnapshotHwasState, attrSnapshot.hwasState,
+                           hwasState, [target](ATTR_HWAS_STATE_Type& value) {
+                               return !DT_GET_PROP(ATTR_HWAS_STATE, target,
+                                                   value);
+                           });
+}
+
+void refreshAttrSnapshot()
+{
+    std::fill(attrSnapshot.readAttrs.begin(), attrSnapshot.readAttrs.end(), 0);
+}
+
+/**
+ * @brief pdbg callback to add the given target into the physical path index
+ *        and the attributes snapshot.
+ *
+ * @param[in] target current device tree target
+ * @param[in|out] userData for accessing|storing from|to user
+ *
+ * @return 0 to continue traverse
+ */
+int pdbgCallbackToIndexTgt(struct pdbg_target* target, void* userData)
+{
+    PhysPathIndex* index = static_cast<PhysPathIndex*>(userData);
+
+    attrSnapshot.addTarget(target);
+
+    /**
+     * All targets won't have the physical path so, don't use "DT_GET_PROP"
+     * to read attribute because it will add trace if the given attribute
+     * is not found to read.
+     */
+    ATTR_PHYS_BIN_PATH_Type physBinPath;
+    if (!pdbg_target_get_attribute(
+            target, "ATTR_PHYS_BIN_PATH",
+            std::stoi(dtAttr::fapi2::ATTR_PHYS_BIN_PATH_Spec),
+            dtAttr::fapi2::ATTR_PHYS_BIN_PATH_ElementCount, physBinPath))
+    {
+        return continueTgtTraversal;
+    }
+
+    DevTreePhysPath key(std::begin(physBinPath), std::end(physBinPath));
+
+    // Keep the first target in the traversal order if more than one
+    // target is having the same physical path.
+    index->emplace(key, target);
+
+    return continueTgtTraversal;
+}
+
+/**
+ * @brief Used to build the physical path index and the attributes snapshot
+ *        for the phal cec device tree
+ *
+ * @return NULL
+ */
+void buildPhysPathIndex()
+{
+    physPathIndex.clear();
+    attrSnapshot.clear();
+    pdbg_target_traverse(NULL, pdbgCallbackToIndexTgt, &physPathIndex);
+    attrSnapshot.resize();
+}
+
+/**
+ * @brief Used to compute the digest (FNV-1a) of the phal cec device tree blob
+ *
+ * @return The phal cec device tree digest on success
+ *         Empty optional on failure
+ */
+static std::optional<DevTreeDigest> computeDevTreeDigest()
+{
+    std::ifstream devTreeFile(PHAL_DEVTREE, std::ios::binary);
+    if (!devTreeFile)
+    {
+        log<level::ERR>(fmt::format("Failed to open the phal cec device "
+                                    "tree [{}] to compute the digest",
+                                    PHAL_DEVTREE)
+                            .c_str());
+        return std::nullopt;
+    }
+
+    DevTreeDigest digest{14695981039346656037ULL};
+    std::array<char, 64 * 1024> chunk;
+    while (devTreeFile.read(chunk.data(), chunk.size()) ||
+           (devTreeFile.gcount() > 0))
+    {
+        std::for_each(chunk.begin(), chunk.begin() + devTreeFile.gcount(),
+                      [&digest](const auto& byte) {
+                          digest = (digest ^ static_cast<uint8_t>(byte)) *
+                                   1099511628211ULL;
+                      });
+    }
+
+    if (devTreeFile.bad())
+    {
+        log<level::ERR>(fmt::format("Failed to read the phal cec device "
+                                    "tree [{}] to compute the digest",
+                                    PHAL_DEVTREE)
+                            .c_str());
+        return std::nullopt;
+    }
+    return digest;
+}
 
 void initPHAL()
 {
@@ -73,6 +471,36 @@ void initPHAL()
     {
         throw std::runtime_error("pdbg target initialization failed");
     }
+
+    buildPhysPathIndex();
+    instIdIndexes.clear();
+    devTreeDigest = computeDevTreeDigest();
+    ++devTreeGeneration;
+}
+
+void reinitPHAL()
+{
+    // Release the existing phal cec device tree to init with
+    // the changed phal cec device tree.
+    pdbg_release_dt_root();
+
+    initPHAL();
+
+    log<level::INFO>(
+        fmt::format("The phal cec device tree [{}] is reinitialized, "
+                    "generation [{}]",
+                    PHAL_DEVTREE, devTreeGeneration)
+            .c_str());
+}
+
+DevTreeGeneration getDevTreeGeneration()
+{
+    return devTreeGeneration;
+}
+
+std::optional<DevTreeDigest> getDevTreeDigest()
+{
+    return devTreeDigest;
 }
 
 std::optional<LocationCode> getUnexpandedLocCode(const std::string& locCode)
@@ -134,69 +562,18 @@ DevTreePhysPath getPhysicalPath(struct pdbg_target* isolateHw)
             std::string("Failed to get ATTR_PHYS_BIN_PATH") +
             pdbg_target_path(isolateHw));
     }
-    return DevTreePhysPath(physPath,
-                           physPath + sizeof(physPath) / sizeof(physPath[0]));
-}
-
-/**
- * @brief pdbg callback to identify a target based on the given
- *        attribute
- *
- * @param[in] target current device tree target
- * @param[in|out] userData for accessing|storing from|to user
- *
- * @return 0 to continue traverse, non-zero to stop traverse
- */
-int pdbgCallbackToGetTgt(struct pdbg_target* target, void* userData)
-{
-    CecDevTreeHw* cecDevTreeHw = static_cast<CecDevTreeHw*>(userData);
-
-    /**
-     * The use case is, find the target from the cec device tree based on the
-     * given attribute value. So, don't use "DT_GET_PROP" to read attribute
-     * because it will add trace if the given attribute is not found to read.
-     */
-    ATTR_PHYS_BIN_PATH_Type physBinPath;
-    if (!pdbg_target_get_attribute(
-            target, "ATTR_PHYS_BIN_PATH",
-            std::stoi(dtAttr::fapi2::ATTR_PHYS_BIN_PATH_Spec),
-            dtAttr::fapi2::ATTR_PHYS_BIN_PATH_ElementCount, physBinPath))
-    {
-        return continueTgtTraversal;
-    }
-
-    if (std::memcmp(physBinPath, cecDevTreeHw->physBinPath,
-                    sizeof(physBinPath)) != 0)
-    {
-        return continueTgtTraversal;
-    }
-
-    // Found the required cec device tree target (hardware)
-    cecDevTreeHw->reqDevTreeHw = target;
-
-    return requireIsolateHwFound;
+    return DevTreePhysPath(std::begin(physPath), std::end(physPath));
 }
 
 std::optional<struct pdbg_target*>
     getPhalDevTreeTgt(const DevTreePhysPath& physicalPath)
 {
-    CecDevTreeHw cecDevTreeHw;
+    // The targets are indexed by using the full size physical path.
+    auto key = physicalPath;
+    key.resize(DevTreePhysPath::maxSize);
 
-    size_t physBinPathSize = sizeof(cecDevTreeHw.physBinPath);
-    if (physBinPathSize < physicalPath.size())
-    {
-        log<level::ERR>(fmt::format("EntityPath size is mismatch. "
-                                    " Given size [{}] and Expected size [{}]",
-                                    physicalPath.size(), physBinPathSize)
-                            .c_str());
-        return std::nullopt;
-    }
-    std::copy(physicalPath.begin(), physicalPath.end(),
-              cecDevTreeHw.physBinPath);
-
-    auto ret = pdbg_target_traverse(NULL, pdbgCallbackToGetTgt, &cecDevTreeHw);
-
-    if (ret != requireIsolateHwFound)
+    auto it = physPathIndex.find(key);
+    if (it == physPathIndex.end())
     {
         std::stringstream ss;
         std::for_each(physicalPath.begin(), physicalPath.end(),
@@ -212,13 +589,13 @@ std::optional<struct pdbg_target*>
         return std::nullopt;
     }
 
-    return cecDevTreeHw.reqDevTreeHw;
+    return it->second;
 }
 
 std::pair<LocationCode, InstanceId> getFRUDetails(struct pdbg_target* fruTgt)
 {
-    ATTR_LOCATION_CODE_Type frulocCode;
-    if (DT_GET_PROP(ATTR_LOCATION_CODE, fruTgt, frulocCode))
+    LocationCode frulocCode;
+    if (!getLocationCode(fruTgt, frulocCode))
     {
         throw std::runtime_error(
             std::string("Failed to get ATTR_LOCATION_CODE from ") +
@@ -228,21 +605,17 @@ std::pair<LocationCode, InstanceId> getFRUDetails(struct pdbg_target* fruTgt)
     InstanceId instanceId{type::Invalid_InstId};
     ATTR_MRU_ID_Type mruId;
     /**
-     * The use case is, get mru id if present in the FRU target
-     * so don't use "DT_GET_PROP" to read attribute because it will add trace
-     * if the given attribute is not found.
+     * The use case is, get mru id if present in the FRU target.
      *
      * For example, DIMM doesn't have MRU_ID.
      */
-    if (pdbg_target_get_attribute(
-            fruTgt, "ATTR_MRU_ID", std::stoi(dtAttr::fapi2::ATTR_MRU_ID_Spec),
-            dtAttr::fapi2::ATTR_MRU_ID_ElementCount, &mruId))
+    if (getMruId(fruTgt, mruId))
     {
         // Last two byte (from MSB) of MRU_ID having instance number
         instanceId = mruId & 0xFFFF;
     }
 
-    return std::make_pair(LocationCode(frulocCode), instanceId);
+    return std::make_pair(frulocCode, instanceId);
 }
 
 InstanceId getHwInstIdFromDevTree(struct pdbg_target* devTreeTgt)
@@ -250,7 +623,7 @@ InstanceId getHwInstIdFromDevTree(struct pdbg_target* devTreeTgt)
     bool isChipletUnit = false;
 
     ATTR_CHIPLET_ID_Type chipletId;
-    if (!DT_GET_PROP(ATTR_CHIPLET_ID, devTreeTgt, chipletId))
+    if (getChipletId(devTreeTgt, chipletId))
     {
         if (chipletId != 0xFF)
         {
@@ -276,7 +649,7 @@ InstanceId getHwInstIdFromDevTree(struct pdbg_target* devTreeTgt)
         else
         {
             ATTR_CHIP_UNIT_POS_Type devTreeChipUnitPos;
-            if (DT_GET_PROP(ATTR_CHIP_UNIT_POS, devTreeTgt, devTreeChipUnitPos))
+            if (!getChipUnitPos(devTreeTgt, devTreeChipUnitPos))
             {
                 throw std::runtime_error(
                     std::string("Failed to get ATTR_CHIP_UNIT_POS from ") +
@@ -290,15 +663,9 @@ InstanceId getHwInstIdFromDevTree(struct pdbg_target* devTreeTgt)
         /**
          * Check If MRU_ID is present. If yes, use it else use pdbg target index
          * Example: The MRU_ID is present for nx which is not a chiplet
-         *
-         * Don't use "DT_GET_PROP" to read attribute because it will add trace
-         * if the given attribute is not found.
          */
         ATTR_MRU_ID_Type devTreeMruId;
-        if (pdbg_target_get_attribute(
-                devTreeTgt, "ATTR_MRU_ID",
-                std::stoi(dtAttr::fapi2::ATTR_MRU_ID_Spec),
-                dtAttr::fapi2::ATTR_MRU_ID_ElementCount, &devTreeMruId))
+        if (getMruId(devTreeTgt, devTreeMruId))
         {
             // Last two byte (from MSB) of MRU_ID having instance number
             instanceId = devTreeMruId & 0xFFFF;
@@ -339,7 +706,7 @@ DevTreePhysPath
 bool isECOcore(struct pdbg_target* coreTgt)
 {
     ATTR_ECO_MODE_Type ecoMode;
-    if (DT_GET_PROP(ATTR_ECO_MODE, coreTgt, ecoMode))
+    if (!getEcoMode(coreTgt, ecoMode))
     {
         log<level::ERR>(
             fmt::format(
@@ -359,6 +726,244 @@ bool isECOcore(struct pdbg_target* coreTgt)
     }
 }
 
+/**
+ * @brief Helper function to get the instance id kind of the given
+ *        lookup function.
+ *
+ * @param[in] lookupFunc - The lookup function to get instance id kind
+ *
+ * @return The instance id kind on success
+ *         Empty optional if the given lookup function is unknown
+ */
+std::optional<InstIdKind>
+    getInstIdKind(lookup_func::LookupFuncForPhysPath lookupFunc)
+{
+    if (lookupFunc == lookup_func::mruId)
+    {
+        return InstIdKind::MruId;
+    }
+    else if (lookupFunc == lookup_func::chipUnitPos)
+    {
+        return InstIdKind::ChipUnitPos;
+    }
+    else if (lookupFunc == lookup_func::locationCode)
+    {
+        return InstIdKind::LocationCode;
+    }
+    else if (lookupFunc == lookup_func::pdbgIndex)
+    {
+        return InstIdKind::PdbgIndex;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Helper function to get the location code and instance id of
+ *        the given target to index based on the given instance id kind.
+ *
+ * @param[in] tgt - The target to get the index key
+ * @param[in] instIdKind - The instance id kind
+ *
+ * @return pair<LocationCode, InstanceId> on success
+ *         Empty optional if the target doesn't contain the required
+ *         attribute
+ *
+ * @note The location code will be empty if the given lookup kind is not
+ *       depends on the location code and the instance id will be "0" if
+ *       the given lookup kind is not depends on the instance id.
+ */
+std::optional<std::pair<LocationCode, InstanceId>>
+    getInstIdIndexKey(struct pdbg_target* tgt, const InstIdKind instIdKind)
+{
+    LocationCode devTreelocCode;
+    bool hasLocCode = getLocationCode(tgt, devTreelocCode);
+
+    switch (instIdKind)
+    {
+        case InstIdKind::MruId:
+        {
+            ATTR_MRU_ID_Type devTreeMruId;
+            if (!getMruId(tgt, devTreeMruId))
+            {
+                return std::nullopt;
+            }
+            // Last two byte (from MSB) of MRU_ID having instance number
+            // and the location code is checked only if the target have.
+            return std::make_pair(hasLocCode ? devTreelocCode : LocationCode(),
+                                  devTreeMruId & 0xFFFF);
+        }
+        case InstIdKind::ChipUnitPos:
+        {
+            ATTR_CHIP_UNIT_POS_Type devTreeChipUnitPos;
+            if (!getChipUnitPos(tgt, devTreeChipUnitPos))
+            {
+                return std::nullopt;
+            }
+            return std::make_pair(LocationCode(), devTreeChipUnitPos);
+        }
+        case InstIdKind::LocationCode:
+        {
+            if (!hasLocCode)
+            {
+                return std::nullopt;
+            }
+            return std::make_pair(devTreelocCode, 0);
+        }
+        case InstIdKind::PdbgIndex:
+        {
+            return std::make_pair(LocationCode(), pdbg_target_index(tgt));
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Used to get the instance id index for the given pdbg class
+ *        and instance id kind.
+ *
+ * @param[in] pdbgClass - The pdbg class to get the index
+ * @param[in] instIdKind - The instance id kind to get the index
+ *
+ * @return The instance id index
+ *
+ * @note The index will be built if it is not built already.
+ */
+const InstIdIndex& getInstIdIndex(const std::string& pdbgClass,
+                                  const InstIdKind instIdKind)
+{
+    auto indexKey = std::make_pair(pdbgClass, instIdKind);
+    if (auto it = instIdIndexes.find(indexKey); it != instIdIndexes.end())
+    {
+        return it->second;
+    }
+
+    InstIdIndex& index = instIdIndexes[indexKey];
+
+    size_t traversalOrder{0};
+    struct pdbg_target* tgt;
+    pdbg_for_each_class_target(pdbgClass.c_str(), tgt)
+    {
+        auto tgtKey = getInstIdIndexKey(tgt, instIdKind);
+        if (!tgtKey.has_value())
+        {
+            continue;
+        }
+
+        // Keep all the targets in the traversal order if more than one
+        // target is matched for the same key, and add the target under
+        // all its parents to look up the target under the given parent.
+        index[std::make_tuple(nullptr, tgtKey->first, tgtKey->second)]
+            .emplace_back(traversalOrder, tgt);
+        for (auto parentTgt = pdbg_target_parent(NULL, tgt);
+             parentTgt != nullptr;
+             parentTgt = pdbg_target_parent(NULL, parentTgt))
+        {
+            index[std::make_tuple(parentTgt, tgtKey->first, tgtKey->second)]
+                .emplace_back(traversalOrder, tgt);
+        }
+        ++traversalOrder;
+    }
+
+    return index;
+}
+
+std::vector<struct pdbg_target*>
+    getTgtsByInstId(const std::string& pdbgClass, const InstanceId instanceId,
+                    const LocationCode& locCode,
+                    lookup_func::LookupFuncForPhysPath lookupFunc,
+                    struct pdbg_target* parentTgt)
+{
+    std::vector<struct pdbg_target*> tgts;
+
+    auto instIdKind = getInstIdKind(lookupFunc);
+    if (!instIdKind.has_value())
+    {
+        // Unknown lookup function so, traverse to find the targets.
+        struct pdbg_target* tgt;
+        if (parentTgt == nullptr)
+        {
+            pdbg_for_each_class_target(pdbgClass.c_str(), tgt)
+            {
+                if (lookupFunc(tgt, instanceId, locCode))
+                {
+                    tgts.emplace_back(tgt);
+                }
+            }
+        }
+        else
+        {
+            pdbg_for_each_target(pdbgClass.c_str(), parentTgt, tgt)
+            {
+                if (lookupFunc(tgt, instanceId, locCode))
+                {
+                    tgts.emplace_back(tgt);
+                }
+            }
+        }
+        return tgts;
+    }
+
+    const auto& index = getInstIdIndex(pdbgClass, *instIdKind);
+
+    std::vector<InstIdIndexKey> keysToLookup;
+    switch (*instIdKind)
+    {
+        case InstIdKind::MruId:
+            // The target might not have the location code.
+            keysToLookup.emplace_back(parentTgt, locCode, instanceId);
+            if (!locCode.empty())
+            {
+                keysToLookup.emplace_back(parentTgt, LocationCode(),
+                                          instanceId);
+            }
+            break;
+        case InstIdKind::ChipUnitPos:
+        case InstIdKind::PdbgIndex:
+            keysToLookup.emplace_back(parentTgt, LocationCode(), instanceId);
+            break;
+        case InstIdKind::LocationCode:
+            keysToLookup.emplace_back(parentTgt, locCode, 0);
+            break;
+    }
+
+    // Merge the matched targets of all the keys in the traversal order
+    // to get the same order as traversing all the pdbg class targets.
+    InstIdIndexTgts matchedTgts;
+    for (const auto& key : keysToLookup)
+    {
+        if (auto it = index.find(key); it != index.end())
+        {
+            InstIdIndexTgts mergedTgts;
+            mergedTgts.reserve(matchedTgts.size() + it->second.size());
+            std::ranges::merge(matchedTgts, it->second,
+                               std::back_inserter(mergedTgts));
+            matchedTgts = std::move(mergedTgts);
+        }
+    }
+
+    tgts.reserve(matchedTgts.size());
+    std::ranges::transform(matchedTgts, std::back_inserter(tgts),
+                           [](const auto& tgt) { return tgt.second; });
+    return tgts;
+}
+
+std::optional<struct pdbg_target*>
+    getTgtByInstId(const std::string& pdbgClass, const InstanceId instanceId,
+                   const LocationCode& locCode,
+                   lookup_func::LookupFuncForPhysPath lookupFunc,
+                   struct pdbg_target* parentTgt)
+{
+    auto tgts =
+        getTgtsByInstId(pdbgClass, instanceId, locCode, lookupFunc, parentTgt);
+    if (tgts.empty())
+    {
+        return std::nullopt;
+    }
+
+    // The first matched target in the traversal order.
+    return tgts.front();
+}
+
 namespace lookup_func
 {
 CanGetPhysPath mruId(struct pdbg_target* pdbgTgt, InstanceId instanceId,
@@ -367,7 +972,7 @@ CanGetPhysPath mruId(struct pdbg_target* pdbgTgt, InstanceId instanceId,
     CanGetPhysPath canGetPhysPath = false;
 
     ATTR_MRU_ID_Type devTreeMruId;
-    if (DT_GET_PROP(ATTR_MRU_ID, pdbgTgt, devTreeMruId))
+    if (!getMruId(pdbgTgt, devTreeMruId))
     {
         throw std::runtime_error(
             std::string("Failed to get ATTR_MRU_ID from ") +
@@ -382,13 +987,12 @@ CanGetPhysPath mruId(struct pdbg_target* pdbgTgt, InstanceId instanceId,
 
     // If given target having location attribute then check that with given
     // location code.
-    ATTR_LOCATION_CODE_Type devTreelocCode;
-    if (!DT_GET_PROP(ATTR_LOCATION_CODE, pdbgTgt, devTreelocCode) &&
-        (canGetPhysPath == true))
+    LocationCode devTreelocCode;
+    if (getLocationCode(pdbgTgt, devTreelocCode) && (canGetPhysPath == true))
     {
         // If location code did not match then given device tree target is not
         // expected one.
-        if (LocationCode(devTreelocCode) != locCode)
+        if (devTreelocCode != locCode)
         {
             canGetPhysPath = false;
         }
@@ -403,7 +1007,7 @@ CanGetPhysPath chipUnitPos(struct pdbg_target* pdbgTgt, InstanceId instanceId,
     CanGetPhysPath canGetPhysPath = false;
 
     ATTR_CHIP_UNIT_POS_Type devTreeChipUnitPos;
-    if (DT_GET_PROP(ATTR_CHIP_UNIT_POS, pdbgTgt, devTreeChipUnitPos))
+    if (!getChipUnitPos(pdbgTgt, devTreeChipUnitPos))
     {
         throw std::runtime_error(
             std::string("Failed to get ATTR_CHIP_UNIT_POS from ") +
@@ -421,15 +1025,15 @@ CanGetPhysPath locationCode(struct pdbg_target* pdbgTgt,
 {
     CanGetPhysPath canGetPhysPath = false;
 
-    ATTR_LOCATION_CODE_Type devTreelocCode;
-    if (DT_GET_PROP(ATTR_LOCATION_CODE, pdbgTgt, devTreelocCode))
+    LocationCode devTreelocCode;
+    if (!getLocationCode(pdbgTgt, devTreelocCode))
     {
         throw std::runtime_error(
             std::string("Failed to get ATTR_LOCATION_CODE from ") +
             pdbg_target_path(pdbgTgt));
     }
 
-    if (LocationCode(devTreelocCode) == locCode)
+    if (devTreelocCode == locCode)
     {
         canGetPhysPath = true;
     }
@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/resolution_cache.hpp"
+
+#include "common/persist_journal.hpp"
+
+#include <fmt/format.h>
+
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/utility.hpp>
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+
+namespace hw_isolation
+{
+namespace resolution_cache
+{
+
+using namespace phosphor::logging;
+
+// The BMC boot id which is changed for every BMC boot, and the inventory is
+// recreated for every BMC boot.
+constexpr auto BOOT_ID_PATH = "/proc/sys/kernel/random/boot_id";
+
+using Resolutions = std::map<ResolutionKey, Resolution>;
+
+/**
+ * @brief The persisted resolution cache
+ */
+struct CacheImage
+{
+    devtree::DevTreeDigest devTreeDigest{0};
+    std::string bootId;
+    Resolutions resolutions;
+
+    /**
+     * @brief Helper template that is required by Cereal to perform
+     *        serialization and deserialization.
+     *
+     * @tparam Archive    - Cereal archive type.
+     * @param[in] archive - Reference to Cereal archive.
+     *
+     * @return NULL
+     */
+    template <class Archive>
+    void serialize(Archive& archive)
+    {
+        archive(devTreeDigest, bootId, resolutions);
+    }
+};
+
+/**
+ * @brief The resolutions to persist
+ */
+static Resolutions resolutions;
+
+/**
+ * @brief The phal cec device tree generation of the resolutions
+ */
+static devtree::DevTreeGeneration resolutionsGeneration{0};
+
+/**
+ * @brief Used to indicate whether the resolutions are changed since
+ *        they are persisted.
+ */
+static bool resolutionsChanged{false};
+
+/**
+ * @brief The persisted resolutions (keys) which are not yet confirmed
+ *        by the live lookup.
+ */
+static std::set<ResolutionKey> unconfirmedKeys;
+
+/**
+ * @brief The persisted resolutions which are served during the warm start
+ *        and waiting to confirm.
+ */
+static Resolutions servedResolutions;
+
+/**
+ * @brief Used to indicate whether the persisted resolutions can be served
+ */
+static bool warmStart{false};
+
+/**
+ * @brief The current BMC boot id
+ */
+static std::string bootId;
+
+/**
+ * @brief Helper function to read the current BMC boot id
+ *
+ * @return The BMC boot id on success
+ *         Empty string on failure
+ */
+static std::string readBootId()
+{
+    std::string id;
+    std::ifstream bootIdFile(BOOT_ID_PATH);
+    if (!std::getline(bootIdFile, id))
+    {
+        log<level::ERR>(
+            fmt::format("Failed to read the BMC boot id from [{}]",
+                        BOOT_ID_PATH)
+                .c_str());
+        return std::string();
+    }
+    return id;
+}
+
+/**
+ * @brief Used to drop the resolutions if the phal cec device tree is
+ *        reinitialized since the resolutions are resolved.
+ *
+ * @return NULL
+ */
+static void validateGeneration()
+{
+    auto devTreeGeneration = devtree::getDevTreeGeneration();
+    if (devTreeGeneration == resolutionsGeneration)
+    {
+        return;
+    }
+
+    if (!resolutions.empty())
+    {
+        resolutions.clear();
+        resolutionsChanged = true;
+    }
+    unconfirmedKeys.clear();
+    warmStart = false;
+    resolutionsGeneration = devTreeGeneration;
+}
+
+void initResolutionCache()
+{
+    bootId = readBootId();
+    resolutionsGeneration = devtree::getDevTreeGeneration();
+
+    auto devTreeDigest = devtree::getDevTreeDigest();
+    if (bootId.empty() || !devTreeDigest.has_value())
+    {
+        // The resolutions can't be validated to use after the restart.
+        return;
+    }
+
+    CacheImage image;
+    try
+    {
+        if (!journal::load(journal::ObjectKind::ResolutionCache, 0, image))
+        {
+            return;
+        }
+    }
+    catch (const cereal::Exception& e)
+    {
+        log<level::ERR>(fmt::format("Exception: [{}] during deserialize the "
+                                    "inventory path resolution cache",
+                                    e.what())
+                            .c_str());
+        journal::erase(journal::ObjectKind::ResolutionCache, 0);
+        return;
+    }
+
+    if ((image.devTreeDigest != *devTreeDigest) || (image.bootId != bootId))
+    {
+        // The phal cec device tree or the inventory might be changed.
+        journal::erase(journal::ObjectKind::ResolutionCache, 0);
+        return;
+    }
+
+    resolutions = std::move(image.resolutions);
+    std::ranges::for_each(resolutions, [](const auto& resolution) {
+        unconfirmedKeys.emplace_hint(unconfirmedKeys.end(), resolution.first);
+    });
+    warmStart = !resolutions.empty();
+
+    log<level::INFO>(fmt::format("Restored [{}] persisted inventory path "
+                                 "resolutions to use in the warm start",
+                                 resolutions.size())
+                         .c_str());
+}
+
+std::optional<Resolution> getUnconfirmed(const ResolutionKey& key)
+{
+    validateGeneration();
+
+    if (!warmStart || !unconfirmedKeys.contains(key))
+    {
+        return std::nullopt;
+    }
+
+    auto resolution = resolutions.find(key);
+    if (resolution == resolutions.end())
+    {
+        return std::nullopt;
+    }
+
+    servedResolutions.insert_or_assign(key, resolution->second);
+    return resolution->second;
+}
+
+void update(const ResolutionKey& key,
+            const std::optional<Resolution>& resolution)
+{
+    validateGeneration();
+
+    unconfirmedKeys.erase(key);
+
+    if (!resolution.has_value())
+    {
+        resolutionsChanged |= resolutions.erase(key) > 0;
+        return;
+    }
+
+    auto [resolutionIt, inserted] = resolutions.try_emplace(key, *resolution);
+    if (!inserted && (resolutionIt->second != *resolution))
+    {
+        resolutionIt->second = *resolution;
+        inserted = true;
+    }
+    resolutionsChanged |= inserted;
+}
+
+std::optional<std::pair<ResolutionKey, Resolution>> takeServed()
+{
+    if (servedResolutions.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto served = servedResolutions.extract(servedResolutions.begin());
+    unconfirmedKeys.erase(served.key());
+    return std::make_pair(std::move(served.key()), std::move(served.mapped()));
+}
+
+void endWarmStart()
+{
+    validateGeneration();
+
+    warmStart = false;
+    std::ranges::for_each(unconfirmedKeys, [](const auto& key) {
+        resolutionsChanged |= resolutions.erase(key) > 0;
+    });
+    unconfirmedKeys.clear();
+}
+
+void invalidate(const std::string& inventoryObjPath)
+{
+    validateGeneration();
+
+    auto isChanged = [&inventoryObjPath](const auto& resolution) {
+        const auto& path = resolution.second.inventoryPath;
+        return path.starts_with(inventoryObjPath) &&
+               ((path.size() == inventoryObjPath.size()) ||
+                (path[inventoryObjPath.size()] == '/'));
+    };
+
+    bool dropped{false};
+    std::erase_if(resolutions, [&isChanged, &dropped](const auto& resolution) {
+        if (!isChanged(resolution))
+        {
+            return false;
+        }
+        unconfirmedKeys.erase(resolution.first);
+        dropped = true;
+        return true;
+    });
+
+    if (!dropped)
+    {
+        return;
+    }
+    resolutionsChanged = true;
+
+    // Don't use the persisted resolutions if the daemon is restarted
+    // before persisting the resolutions again but, the persisted
+    // resolutions are persisted at the end of the warm start.
+    if (!warmStart)
+    {
+        persist();
+    }
+}
+
+void persist()
+{
+    validateGeneration();
+
+    if (!resolutionsChanged)
+    {
+        return;
+    }
+    resolutionsChanged = false;
+
+    auto devTreeDigest = devtree::getDevTreeDigest();
+    if (resolutions.empty() || bootId.empty() || !devTreeDigest.has_value())
+    {
+        journal::erase(journal::ObjectKind::ResolutionCache, 0);
+        return;
+    }
+
+    try
+    {
+        journal::save(journal::ObjectKind::ResolutionCache, 0,
+                      CacheImage{*devTreeDigest, bootId, resolutions});
+    }
+    catch (const cereal::Exception& e)
+    {
+        log<level::ERR>(fmt::format("Exception: [{}] during serialize the "
+                                    "inventory path resolution cache",
+                                    e.what())
+                            .c_str());
+        journal::erase(journal::ObjectKind::ResolutionCache, 0);
+    }
+}
+
+} // namespace resolution_cache
+} // namespace hw_isolation
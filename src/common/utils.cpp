@@ -4,8 +4,12 @@
 
 #include "common/phal_devtree_utils.hpp"
 
+#include <sdbusplus/bus/match.hpp>
 #include <xyz/openbmc_project/State/Chassis/server.hpp>
 
+#include <map>
+#include <memory>
+
 namespace hw_isolation
 {
 namespace utils
@@ -22,20 +26,215 @@ void initExternalModules()
     openpower_guard::libguard::libguard_init(false);
 }
 
+/**
+ * @brief The cached D-Bus service name by using the object path and
+ *        the interface name.
+ */
+static std::map<std::pair<std::string, std::string>, std::string>
+    serviceNameCache;
+
+/**
+ * @brief The D-Bus match objects to invalidate the cached D-Bus service
+ *        name if the service is lost, by using the service name.
+ */
+static std::map<std::string, std::unique_ptr<sdbusplus::bus::match::match>>
+    serviceOwnerWatchers;
+
+/**
+ * @brief The D-Bus match objects to invalidate the cached D-Bus service
+ *        name if the object interfaces are removed, by using the object
+ *        path namespace.
+ */
+static std::map<std::string, std::unique_ptr<sdbusplus::bus::match::match>>
+    interfacesRemovedWatchers;
+
+/**
+ * @brief Helper function to get the object path namespace to watch the
+ *        interfaces remove i.e. the first three elements of the given
+ *        object path (for example, "/xyz/openbmc_project/inventory/").
+ *
+ * @param[in] path - The object path to get the namespace
+ *
+ * @return The object path namespace with the trailing "/"
+ */
+static std::string getWatchedPathNamespace(const std::string& path)
+{
+    constexpr auto namespaceElements = 3;
+
+    size_t pos{0};
+    for (auto element = 0; element < namespaceElements; ++element)
+    {
+        pos = path.find('/', pos + 1);
+        if (pos == std::string::npos)
+        {
+            return path.ends_with('/') ? path : path + "/";
+        }
+    }
+    return path.substr(0, pos + 1);
+}
+
+/**
+ * @brief Used to watch the given D-Bus service owner lost and the interfaces
+ *        remove of the given object path namespace to invalidate the cached
+ *        D-Bus service name.
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] path - The object path of the D-Bus service name to cache
+ * @param[in] serviceName - The D-Bus service name to cache
+ *
+ * @return true if the D-Bus service name can be cached
+ *         false if not
+ *
+ * @note The D-Bus match objects are added only once for each D-Bus service
+ *       name and object path namespace.
+ */
+static bool watchServiceNameChange(sdbusplus::bus::bus& bus,
+                                   const std::string& path,
+                                   const std::string& serviceName)
+{
+    try
+    {
+        namespace sdbusplus_match = sdbusplus::bus::match;
+
+        if (!serviceOwnerWatchers.contains(serviceName))
+        {
+            // The empty new owner indicates the service is lost.
+            serviceOwnerWatchers.emplace(
+                serviceName,
+                std::make_unique<sdbusplus_match::match>(
+                    bus,
+                    sdbusplus_match::rules::nameOwnerChanged(serviceName) +
+                        sdbusplus_match::rules::argN(2, ""),
+                    [serviceName](sdbusplus::message::message&) {
+                        std::erase_if(serviceNameCache,
+                                      [&serviceName](const auto& ele) {
+                                          return ele.second == serviceName;
+                                      });
+                    }));
+        }
+
+        auto pathNamespace = getWatchedPathNamespace(path);
+        if (!interfacesRemovedWatchers.contains(pathNamespace))
+        {
+            // The InterfacesRemoved signal is sent by the object manager
+            // which might be any parent of the object so, use the object
+            // path (first argument) to match the namespace.
+            interfacesRemovedWatchers.emplace(
+                pathNamespace,
+                std::make_unique<sdbusplus_match::match>(
+                    bus,
+                    sdbusplus_match::rules::interfacesRemoved() +
+                        sdbusplus_match::rules::argNpath(0, pathNamespace),
+                    [](sdbusplus::message::message& message) {
+                        sdbusplus::message::object_path objPath;
+                        std::vector<std::string> interfaces;
+                        message.read(objPath, interfaces);
+
+                        for (const auto& interface : interfaces)
+                        {
+                            serviceNameCache.erase(
+                                std::make_pair(objPath.str, interface));
+                        }
+                    }));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // The cache can't be invalidated so, don't cache.
+        log<level::ERR>(
+            fmt::format("Exception [{}] while adding the D-Bus match rules "
+                        "to watch the D-Bus service [{}] name change",
+                        e.what(), serviceName)
+                .c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Helper function to get the service which hosts the given object
+ *        interface from the object mapper "GetObject" reply, and cache it
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] path - The object path
+ * @param[in] interface - The object interface
+ * @param[in] servicesName - The object mapper "GetObject" reply
+ *
+ * @return The service name on success
+ *         Empty optional if the object is not hosted by a single service
+ */
+static std::optional<std::string> getOwnerServiceName(
+    sdbusplus::bus::bus& bus, const std::string& path,
+    const std::string& interface,
+    const std::vector<std::pair<std::string, std::vector<std::string>>>&
+        servicesName)
+{
+    // In OpenBMC, the object path will be hosted by a single service
+    // i.e more than one service cannot host the same object path.
+    if (servicesName.size() != 1)
+    {
+        std::string serviceNameList{""};
+
+        std::for_each(servicesName.begin(), servicesName.end(),
+                      [&serviceNameList](const auto& serviceName) {
+                          serviceNameList.append(serviceName.first + ",");
+                      });
+
+        log<level::ERR>(fmt::format("The given object path hosted by "
+                                    "more than one services [{}]",
+                                    serviceNameList)
+                            .c_str());
+        return std::nullopt;
+    }
+
+    if (watchServiceNameChange(bus, path, servicesName[0].first))
+    {
+        serviceNameCache.insert_or_assign(std::make_pair(path, interface),
+                                          servicesName[0].first);
+    }
+
+    return servicesName[0].first;
+}
+
+/**
+ * @brief Helper function to create the object mapper "GetObject" method
+ *        call to get the service which hosts the given object interface
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] path - The object path
+ * @param[in] interface - The object interface
+ *
+ * @return The D-Bus method call message
+ */
+static sdbusplus::message::message
+    newMapperGetObjectMethod(sdbusplus::bus::bus& bus, const std::string& path,
+                             const std::string& interface)
+{
+    auto method =
+        bus.new_method_call(type::ObjectMapperName, type::ObjectMapperPath,
+                            type::ObjectMapperName, "GetObject");
+
+    method.append(path);
+    method.append(std::vector<std::string>({interface}));
+    return method;
+}
+
 std::string getDBusServiceName(sdbusplus::bus::bus& bus,
                                const std::string& path,
                                const std::string& interface)
 {
+    auto cachedServiceName =
+        serviceNameCache.find(std::make_pair(path, interface));
+    if (cachedServiceName != serviceNameCache.end())
+    {
+        return cachedServiceName->second;
+    }
+
     std::vector<std::pair<std::string, std::vector<std::string>>> servicesName;
 
     try
     {
-        auto method =
-            bus.new_method_call(type::ObjectMapperName, type::ObjectMapperPath,
-                                type::ObjectMapperName, "GetObject");
-
-        method.append(path);
-        method.append(std::vector<std::string>({interface}));
+        auto method = newMapperGetObjectMethod(bus, path, interface);
 
         auto reply = bus.call(method);
         reply.read(servicesName);
@@ -50,26 +249,96 @@ std::string getDBusServiceName(sdbusplus::bus::bus& bus,
             const_cast<sd_bus_error*>(e.get_error()), "HW-Isolation");
     }
 
-    // In OpenBMC, the object path will be hosted by a single service
-    // i.e more than one service cannot host the same object path.
-    if (servicesName.size() > 1)
+    auto serviceName = getOwnerServiceName(bus, path, interface, servicesName);
+    if (!serviceName.has_value())
     {
-        std::string serviceNameList{""};
+        throw std::runtime_error(
+            "Given object path hosted by more than one service");
+    }
+    return *serviceName;
+}
 
-        std::for_each(servicesName.begin(), servicesName.end(),
-                      [&serviceNameList](const auto& serviceName) {
-                          serviceNameList.append(serviceName.first + ",");
-                      });
+void getDBusServiceName(dbus_async::CallPipeline& pipeline,
+                        sdbusplus::bus::bus& bus, const std::string& path,
+                        const std::string& interface,
+                        ServiceNameHandler handler)
+{
+    auto cachedServiceName =
+        serviceNameCache.find(std::make_pair(path, interface));
+    if (cachedServiceName != serviceNameCache.end())
+    {
+        handler(cachedServiceName->second, nullptr);
+        return;
+    }
 
-        log<level::ERR>(fmt::format("The given object path hosted by "
-                                    "more than one services [{}]",
-                                    serviceNameList)
+    pipeline.call(
+        newMapperGetObjectMethod(bus, path, interface),
+        [&bus, path, interface, handler](sdbusplus::message::message& reply,
+                                         const sd_bus_error* error) {
+            if (error != nullptr)
+            {
+                handler(std::nullopt, error);
+                return;
+            }
+
+            std::vector<std::pair<std::string, std::vector<std::string>>>
+                servicesName;
+            try
+            {
+                reply.read(servicesName);
+            }
+            catch (const sdbusplus::exception::exception& e)
+            {
+                log<level::ERR>(
+                    fmt::format("Exception [{}] to read dbus service name "
+                                "for object [{}] and interface [{}]",
+                                e.what(), path, interface)
+                        .c_str());
+                handler(std::nullopt, nullptr);
+                return;
+            }
+
+            handler(getOwnerServiceName(bus, path, interface, servicesName),
+                    nullptr);
+        });
+}
+
+dbus_async::Task<std::string>
+    getDBusServiceName(dbus_async::CallPipeline& pipeline,
+                       sdbusplus::bus::bus& bus, std::string path,
+                       std::string interface)
+{
+    auto cachedServiceName =
+        serviceNameCache.find(std::make_pair(path, interface));
+    if (cachedServiceName != serviceNameCache.end())
+    {
+        co_return cachedServiceName->second;
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> servicesName;
+
+    try
+    {
+        auto reply = co_await pipeline.awaitCall(
+            newMapperGetObjectMethod(bus, path, interface));
+        reply.read(servicesName);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(fmt::format("Exception [{}] to get dbus service name "
+                                    "for object [{}] and interface [{}]",
+                                    e.what(), path, interface)
                             .c_str());
+        throw;
+    }
+
+    auto serviceName = getOwnerServiceName(bus, path, interface, servicesName);
+    if (!serviceName.has_value())
+    {
         throw std::runtime_error(
             "Given object path hosted by more than one service");
     }
-
-    return servicesName[0].first;
+    co_return *serviceName;
 }
 
 bool isHwIosolationSettingEnabled(sdbusplus::bus::bus& bus)
@@ -88,6 +357,25 @@ bool isHwIosolationSettingEnabled(sdbusplus::bus::bus& bus)
     }
 }
 
+dbus_async::Task<bool>
+    isHwIosolationSettingEnabled(dbus_async::CallPipeline& pipeline,
+                                 sdbusplus::bus::bus& bus)
+{
+    try
+    {
+        co_return co_await utils::getDBusPropertyVal<bool>(
+            pipeline, bus,
+            "/xyz/openbmc_project/hardware_isolation/allow_hw_isolation",
+            "xyz.openbmc_project.Object.Enable", "Enabled");
+    }
+    catch (const std::exception& e)
+    {
+        // Log is already added in getDBusPropertyVal()
+        // By default, the HardwareIsolation feature is need to allow
+        co_return true;
+    }
+}
+
 void isHwDeisolationAllowed(sdbusplus::bus::bus& bus)
 {
     // Make sure the hardware isolation setting is enabled or not
@@ -116,6 +404,103 @@ void isHwDeisolationAllowed(sdbusplus::bus::bus& bus)
     }
 }
 
+constexpr auto inventoryMgrServiceName =
+    "xyz.openbmc_project.Inventory.Manager";
+constexpr auto inventoryMgrObjPath = "/xyz/openbmc_project/inventory";
+
+using EnabledPropValue = std::variant<bool>;
+using EnabledPropMap = std::map<std::string, EnabledPropValue>;
+using EnabledInterfaceMap = std::map<std::string, EnabledPropMap>;
+using EnabledObjectValueTree =
+    std::map<sdbusplus::message::object_path, EnabledInterfaceMap>;
+
+/**
+ * @brief Helper function to add the Enabled property value of the given
+ *        object path into the Inventory Manager "Notify" object value tree
+ *
+ * @param[in,out] objectValueTree - The object value tree to add into
+ * @param[in] dbusObjPath - The object path to set enabled property value
+ * @param[in] enabledPropVal - set the enabled property value
+ *
+ * @return NULL
+ */
+static void addEnabledPropertyObject(EnabledObjectValueTree& objectValueTree,
+                                     const std::string& dbusObjPath,
+                                     bool enabledPropVal)
+{
+    EnabledInterfaceMap interfaceMap;
+    EnabledPropMap propertyMap;
+    propertyMap.emplace("Enabled", enabledPropVal);
+    interfaceMap.emplace("xyz.openbmc_project.Object.Enable", propertyMap);
+
+    const std::string inventryMgrObjPath{inventoryMgrObjPath};
+
+    std::string objPath(dbusObjPath);
+    if (dbusObjPath.starts_with(inventryMgrObjPath))
+    {
+        // Remove PIM root object path in the given object path
+        // to avoid wrong object tree under the PIM root object path.
+        objPath.erase(0, inventryMgrObjPath.length());
+    }
+    objectValueTree.insert_or_assign(std::move(objPath),
+                                     std::move(interfaceMap));
+}
+
+/**
+ * @brief Helper function to create the Inventory Manager "Notify" method
+ *        call by using the given object value tree
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] objectValueTree - The object value tree to notify
+ *
+ * @return The D-Bus method call message
+ */
+static sdbusplus::message::message
+    newInventoryNotifyMethod(sdbusplus::bus::bus& bus,
+                             EnabledObjectValueTree&& objectValueTree)
+{
+    auto method = bus.new_method_call(
+        inventoryMgrServiceName, inventoryMgrObjPath,
+        "xyz.openbmc_project.Inventory.Manager", "Notify");
+    method.append(std::move(objectValueTree));
+    return method;
+}
+
+/**
+ * @brief Helper function to create the D-Bus method call to set the
+ *        Enabled property value by using the given service
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] serviceName - The service which hosts the given object path
+ * @param[in] dbusObjPath - The object path to set enabled property value
+ * @param[in] enabledPropVal - set the enabled property value
+ *
+ * @return The D-Bus method call message
+ *
+ * @note The Inventory Manager "Notify" method is used if the given object
+ *       path is hosted by the Inventory Manager to persist the value.
+ */
+static sdbusplus::message::message
+    newEnabledPropertyMethod(sdbusplus::bus::bus& bus,
+                             const std::string& serviceName,
+                             const std::string& dbusObjPath,
+                             bool enabledPropVal)
+{
+    if (serviceName != inventoryMgrServiceName)
+    {
+        auto method =
+            bus.new_method_call(serviceName.c_str(), dbusObjPath.c_str(),
+                                "org.freedesktop.DBus.Properties", "Set");
+        method.append("xyz.openbmc_project.Object.Enable", "Enabled",
+                      EnabledPropValue(enabledPropVal));
+        return method;
+    }
+
+    EnabledObjectValueTree objectValueTree;
+    addEnabledPropertyObject(objectValueTree, dbusObjPath, enabledPropVal);
+    return newInventoryNotifyMethod(bus, std::move(objectValueTree));
+}
+
 void setEnabledProperty(sdbusplus::bus::bus& bus,
                         const std::string& dbusObjPath, bool enabledPropVal)
 {
@@ -161,35 +546,8 @@ void setEnabledProperty(sdbusplus::bus::bus& bus,
     {
         if (serviceName == "xyz.openbmc_project.Inventory.Manager")
         {
-            using PropertyValue = std::variant<bool>;
-            using PropertyMap = std::map<std::string, PropertyValue>;
-            using InterfaceMap = std::map<std::string, PropertyMap>;
-            using ObjectValueTree =
-                std::map<sdbusplus::message::object_path, InterfaceMap>;
-
-            ObjectValueTree objectValueTree;
-            InterfaceMap interfaceMap;
-            PropertyMap propertyMap;
-            propertyMap.emplace(enabledPropName, enabledPropVal);
-            interfaceMap.emplace(enabledPropIface, propertyMap);
-
-            const std::string inventryMgrObjPath{
-                "/xyz/openbmc_project/inventory"};
-
-            std::string objPath(dbusObjPath);
-            if (dbusObjPath.starts_with(inventryMgrObjPath))
-            {
-                // Remove PIM root object path in the given object path
-                // to avoid wrong object tree under the PIM root object path.
-                objPath.erase(0, inventryMgrObjPath.length());
-            }
-            objectValueTree.emplace(std::move(objPath),
-                                    std::move(interfaceMap));
-
-            auto method = bus.new_method_call(
-                serviceName.c_str(), inventryMgrObjPath.c_str(),
-                "xyz.openbmc_project.Inventory.Manager", "Notify");
-            method.append(std::move(objectValueTree));
+            auto method = newEnabledPropertyMethod(bus, serviceName,
+                                                   dbusObjPath, enabledPropVal);
             bus.call_noreply(method);
         }
         else
@@ -221,6 +579,244 @@ void setEnabledProperty(sdbusplus::bus::bus& bus,
     }
 }
 
+/**
+ * @brief Helper function to trace the failure to get the service name of
+ *        the given object to set the Enabled property value
+ *
+ * @param[in] dbusObjPath - The object path to set enabled property value
+ * @param[in] error - The D-Bus error of the object mapper call
+ *
+ * @return NULL
+ *
+ * @note The failure is not traced if the object is not implementing
+ *       the Enable interface or the failure is traced already.
+ */
+static void logEnabledServiceNameError(const std::string& dbusObjPath,
+                                       const sd_bus_error* error)
+{
+    if ((error == nullptr) ||
+        (std::string(error->name) ==
+         "xyz.openbmc_project.Common.Error.ResourceNotFound"))
+    {
+        return;
+    }
+    // Refer the synchronous API to know why the failure is not reported.
+    log<level::ERR>(fmt::format("Error [{}] [{}], failed to get service name "
+                                "for the object [{}]",
+                                error->name, error->message, dbusObjPath)
+                        .c_str());
+}
+
+/**
+ * @brief Helper function to add the D-Bus method call to set the Enabled
+ *        property value by using the given service into the pipeline
+ *
+ * @param[in] pipeline - The D-Bus method calls pipeline to use
+ * @param[in] bus - Bus to attach to.
+ * @param[in] serviceName - The service which hosts the given object path
+ * @param[in] dbusObjPath - The object path to set enabled property value
+ * @param[in] enabledPropVal - set the enabled property value
+ *
+ * @return NULL
+ */
+static void callSetEnabledProperty(dbus_async::CallPipeline& pipeline,
+                                   sdbusplus::bus::bus& bus,
+                                   const std::string& serviceName,
+                                   const std::string& dbusObjPath,
+                                   bool enabledPropVal)
+{
+    pipeline.call(
+        newEnabledPropertyMethod(bus, serviceName, dbusObjPath,
+                                 enabledPropVal),
+        [dbusObjPath](sdbusplus::message::message&,
+                      const sd_bus_error* error) {
+            if ((error == nullptr) ||
+                (std::string(error->name) ==
+                 "org.freedesktop.DBus.Error.UnknownProperty"))
+            {
+                return;
+            }
+            // Refer the synchronous API to know why the failure
+            // is not reported.
+            log<level::ERR>(fmt::format("Error [{}] [{}], failed to set "
+                                        "enable D-Bus property for the "
+                                        "object [{}]",
+                                        error->name, error->message,
+                                        dbusObjPath)
+                                .c_str());
+        });
+}
+
+void setEnabledProperty(dbus_async::CallPipeline& pipeline,
+                        sdbusplus::bus::bus& bus,
+                        const std::string& dbusObjPath, bool enabledPropVal)
+{
+    constexpr auto enabledPropIface = "xyz.openbmc_project.Object.Enable";
+
+    getDBusServiceName(
+        pipeline, bus, dbusObjPath, enabledPropIface,
+        [&pipeline, &bus, dbusObjPath,
+         enabledPropVal](const std::optional<std::string>& serviceName,
+                         const sd_bus_error* error) {
+            if (!serviceName.has_value())
+            {
+                logEnabledServiceNameError(dbusObjPath, error);
+                return;
+            }
+            callSetEnabledProperty(pipeline, bus, *serviceName, dbusObjPath,
+                                   enabledPropVal);
+        });
+}
+
+/**
+ * @brief The Enabled property values to set by using the Inventory Manager
+ *        "Notify" once the service name of all the given objects are got
+ */
+struct PendingEnabledProperties
+{
+    EnabledObjectValueTree inventoryMgrObjects;
+    size_t pendingLookups{0};
+};
+
+void setEnabledProperty(dbus_async::CallPipeline& pipeline,
+                        sdbusplus::bus::bus& bus,
+                        const std::vector<std::string>& dbusObjPaths,
+                        bool enabledPropVal)
+{
+    constexpr auto enabledPropIface = "xyz.openbmc_project.Object.Enable";
+
+    // The lookups of the cached service names are completed immediately so,
+    // count this function as the pending lookup until all are added.
+    auto pending = std::make_shared<PendingEnabledProperties>();
+    pending->pendingLookups = dbusObjPaths.size() + 1;
+
+    auto onLookupDone = [&pipeline, &bus, pending]() {
+        if ((--pending->pendingLookups != 0) ||
+            pending->inventoryMgrObjects.empty())
+        {
+            return;
+        }
+
+        auto objectsCount = pending->inventoryMgrObjects.size();
+        pipeline.call(
+            newInventoryNotifyMethod(bus,
+                                     std::move(pending->inventoryMgrObjects)),
+            [objectsCount](sdbusplus::message::message&,
+                           const sd_bus_error* error) {
+                if (error == nullptr)
+                {
+                    return;
+                }
+                log<level::ERR>(
+                    fmt::format("Error [{}] [{}], failed to set enable D-Bus "
+                                "property for [{}] inventory objects",
+                                error->name, error->message, objectsCount)
+                        .c_str());
+            });
+    };
+
+    for (const auto& dbusObjPath : dbusObjPaths)
+    {
+        getDBusServiceName(
+            pipeline, bus, dbusObjPath, enabledPropIface,
+            [&pipeline, &bus, dbusObjPath, enabledPropVal, pending,
+             onLookupDone](const std::optional<std::string>& serviceName,
+                           const sd_bus_error* error) {
+                if (!serviceName.has_value())
+                {
+                    logEnabledServiceNameError(dbusObjPath, error);
+                }
+                else if (*serviceName == inventoryMgrServiceName)
+                {
+                    addEnabledPropertyObject(pending->inventoryMgrObjects,
+                                             dbusObjPath, enabledPropVal);
+                }
+                else
+                {
+                    callSetEnabledProperty(pipeline, bus, *serviceName,
+                                           dbusObjPath, enabledPropVal);
+                }
+                onLookupDone();
+            });
+    }
+    onLookupDone();
+}
+
+void getBMCLogPath(dbus_async::CallPipeline& pipeline,
+                   sdbusplus::bus::bus& bus, const uint32_t eid,
+                   BMCLogPathHandler handler)
+{
+    // If EID is "0" means, no bmc error log.
+    if (eid == 0)
+    {
+        handler(sdbusplus::message::object_path());
+        return;
+    }
+
+    getDBusServiceName(
+        pipeline, bus, type::LoggingObjectPath, type::LoggingInterface,
+        [&pipeline, &bus, eid,
+         handler](const std::optional<std::string>& dbusServiceName,
+                  const sd_bus_error* error) {
+            if (!dbusServiceName.has_value())
+            {
+                if (error != nullptr)
+                {
+                    log<level::ERR>(
+                        fmt::format("Error [{}] [{}] when trying to get "
+                                    "the logging service name for the given "
+                                    "EID (aka PEL ID) [{}]",
+                                    error->name, error->message, eid)
+                            .c_str());
+                }
+                handler(std::nullopt);
+                return;
+            }
+
+            try
+            {
+                auto method = bus.new_method_call(
+                    dbusServiceName->c_str(), type::LoggingObjectPath,
+                    type::LoggingInterface, "GetBMCLogIdFromPELId");
+
+                method.append(static_cast<uint32_t>(eid));
+
+                pipeline.call(
+                    std::move(method),
+                    [eid, handler](sdbusplus::message::message& reply,
+                                   const sd_bus_error* error) {
+                        if (error != nullptr)
+                        {
+                            log<level::ERR>(
+                                fmt::format("Error [{}] [{}] when trying to "
+                                            "get BMC log path for the given "
+                                            "EID (aka PEL ID) [{}]",
+                                            error->name, error->message, eid)
+                                    .c_str());
+                            handler(std::nullopt);
+                            return;
+                        }
+
+                        uint32_t bmcLogId;
+                        reply.read(bmcLogId);
+
+                        handler(sdbusplus::message::object_path(
+                            std::string(type::LoggingObjectPath) +
+                            "/entry/" + std::to_string(bmcLogId)));
+                    });
+            }
+            catch (const sdbusplus::exception::SdBusError& e)
+            {
+                log<level::ERR>(
+                    fmt::format("Exception [{}] when trying to get BMC log "
+                                "path for the given EID (aka PEL ID) [{}]",
+                                e.what(), eid)
+                        .c_str());
+                handler(std::nullopt);
+            }
+        });
+}
+
 std::optional<sdbusplus::message::object_path>
     getBMCLogPath(sdbusplus::bus::bus& bus, const uint32_t eid)
 {
@@ -2,14 +2,44 @@
 
 #include "config.h"
 
+#include "common/inventory_model.hpp"
+#include "common/io_executor.hpp"
+#include "common/isolatable_hardwares.hpp"
+#include "common/persist_journal.hpp"
+#include "common/resolution_cache.hpp"
 #include "common/utils.hpp"
 #include "hw_isolation_event/hw_status_manager.hpp"
 #include "hw_isolation_record/manager.hpp"
 
 #include <fmt/format.h>
+#include <signal.h>
 
 #include <phosphor-logging/elog-errors.hpp>
 #include <sdeventplus/event.hpp>
+#include <sdeventplus/source/signal.hpp>
+
+#include <optional>
+#include <stdexcept>
+
+/**
+ * @brief Used to complete the pending file writes at the daemon exit
+ *        on all the exit paths
+ *
+ * @note It should be destroyed before the D-Bus objects to avoid removing
+ *       their persisted objects while destroying them.
+ */
+struct ExitGuard
+{
+    ExitGuard() = default;
+    ExitGuard(const ExitGuard&) = delete;
+    ExitGuard& operator=(const ExitGuard&) = delete;
+
+    ~ExitGuard()
+    {
+        hw_isolation::journal::closeJournal();
+        hw_isolation::io::shutdownExecutor();
+    }
+};
 
 int main()
 {
@@ -23,22 +53,64 @@ int main()
         auto event = sdeventplus::Event::get_default();
         bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
 
+        // Exit from the event loop on the stop request to complete
+        // the pending file writes.
+        sigset_t exitSignals;
+        sigemptyset(&exitSignals);
+        sigaddset(&exitSignals, SIGTERM);
+        sigaddset(&exitSignals, SIGINT);
+        if (sigprocmask(SIG_BLOCK, &exitSignals, nullptr) < 0)
+        {
+            throw std::runtime_error("Failed to block the exit signals");
+        }
+
+        auto exitLoop = [](sdeventplus::source::Signal& source,
+                           const struct signalfd_siginfo*) {
+            source.get_event().exit(0);
+        };
+        sdeventplus::source::Signal sigTerm(event, SIGTERM, exitLoop);
+        sdeventplus::source::Signal sigInt(event, SIGINT, exitLoop);
+
         // Add sdbusplus ObjectManager for the 'root' path of the hardware
         // isolation manager.
         sdbusplus::server::manager::manager objManager(bus,
                                                        HW_ISOLATION_OBJPATH);
 
-        hw_isolation::record::Manager record_mgr(bus, HW_ISOLATION_OBJPATH,
-                                                 event);
+        // The managers are created after initializing the journal, and
+        // they should be destroyed after closing the journal.
+        std::optional<hw_isolation::record::Manager> record_mgr;
+        std::optional<hw_isolation::event::hw_status::Manager> hwStatusMgr;
+        ExitGuard exitGuard;
+
+        // Prefetch the inventory to avoid the D-Bus round trips for each
+        // inventory lookup while restoring.
+        hw_isolation::inventory::initInventoryModel(bus);
+
+        // Share the resolved isolatable hardwares paths between the record
+        // and the hardware status managers.
+        hw_isolation::isolatable_hws::initPathCache(bus);
+
+        // Run the file I/O in the worker thread to avoid blocking the D-Bus
+        // requests processing.
+        hw_isolation::io::initExecutor(event);
+
+        // Replay the persisted objects at once before restoring.
+        hw_isolation::journal::initJournal();
+
+        // Use the persisted inventory paths of the isolated hardwares
+        // if the daemon is restarted without the inventory and the phal
+        // cec device tree changes.
+        hw_isolation::resolution_cache::initResolutionCache();
+
+        record_mgr.emplace(bus, HW_ISOLATION_OBJPATH, event);
 
         // Restore the isolated hardwares from their persisted location.
-        record_mgr.restore();
+        record_mgr->restore();
 
-        hw_isolation::event::hw_status::Manager hwStatusMgr(bus, event,
-                                                            record_mgr);
+        hwStatusMgr.emplace(bus, event, *record_mgr);
 
         // Restore the hardware status event from their persisted location.
-        hwStatusMgr.restore();
+        hwStatusMgr->restore();
 
         /**
          * The name should be claimed after the D-Bus service is fully
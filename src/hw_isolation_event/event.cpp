@@ -2,14 +2,14 @@
 
 #include "hw_isolation_event/event.hpp"
 
+#include "common/persist_journal.hpp"
+
 #include <fmt/format.h>
 
 #include <cereal/archives/binary.hpp>
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <ctime>
-#include <filesystem>
-#include <fstream>
 
 // Associate Event Class with version number
 constexpr uint32_t Cereal_EventClassVersion = 1;
@@ -19,8 +19,6 @@ namespace hw_isolation
 {
 namespace event
 {
-namespace fs = std::filesystem;
-
 using namespace phosphor::logging;
 
 Event::Event(sdbusplus::bus::bus& bus, const std::string& objPath,
@@ -63,51 +61,38 @@ Event::Event(sdbusplus::bus::bus& bus, const std::string& objPath,
 
 Event::~Event()
 {
-    fs::path path{fmt::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
-    if (fs::exists(path))
-    {
-        fs::remove(path);
-    }
+    journal::erase(journal::ObjectKind::Event, _eventId);
 }
 
 void Event::serialize()
 {
-    fs::path path{fmt::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
     try
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        journal::save(journal::ObjectKind::Event, _eventId, *this);
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(fmt::format("Exception: [{}] during serialize the "
-                                    "hardware isolation status event into {}",
-                                    e.what(), path.string())
+                                    "hardware isolation status event [{}]",
+                                    e.what(), _eventId)
                             .c_str());
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::Event, _eventId);
     }
 }
 
 void Event::deserialize()
 {
-    fs::path path{fmt::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
     try
     {
-        if (fs::exists(path))
-        {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
-            iarchive(*this);
-        }
+        journal::load(journal::ObjectKind::Event, _eventId, *this);
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(fmt::format("Exception: [{}] during deserialize the "
-                                    "hardware isolation status event from {}",
-                                    e.what(), path.string())
+                                    "hardware isolation status event [{}]",
+                                    e.what(), _eventId)
                             .c_str());
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::Event, _eventId);
     }
 }
 
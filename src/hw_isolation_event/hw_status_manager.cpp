@@ -10,6 +10,9 @@ extern "C"
 #include "attributes_info.H"
 
 #include "common/error_log.hpp"
+#include "common/inventory_model.hpp"
+#include "common/persist_journal.hpp"
+#include "common/phal_devtree_blob.hpp"
 #include "common/utils.hpp"
 #include "hw_isolation_event/hw_status_manager.hpp"
 #include "hw_isolation_event/openpower_hw_status.hpp"
@@ -19,6 +22,7 @@ extern "C"
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <filesystem>
+#include <set>
 
 namespace hw_isolation
 {
@@ -48,10 +52,14 @@ Manager::Manager(sdbusplus::bus::bus& bus, const sdeventplus::Event& eventLoop,
     _bus(bus),
     _eventLoop(eventLoop), _lastEventId(0), _isolatableHWs(bus),
     _hwIsolationRecordMgr(hwIsolationRecordMgr),
-    _requiredHwsPdbgClass({"dimm", "fc"})
+    _requiredHwsPdbgClass({"dimm", "fc"}),
+    _devTreeReloadTimer(
+        eventLoop,
+        std::bind(std::mem_fn(&hw_isolation::event::hw_status::Manager::
+                                  reloadDevTree),
+                  this))
 {
-    fs::create_directories(
-        fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path());
+    watchDevTree();
 
     // Adding the required D-Bus match rules to create hardware status event
     // if interested signal is occurred.
@@ -119,10 +127,9 @@ std::optional<sdbusplus::message::object_path> Manager::createEvent(
                 errorLogFwdType, errorLogRevType, bmcErrorLogPath));
         }
 
-        _hwStatusEvents.insert(
-            std::make_pair(id, std::make_unique<hw_isolation::event::Event>(
-                                   _bus, eventObjPath, id, eventSeverity,
-                                   eventMsg, associationDeftoEvent)));
+        addHwStatusEvent(id, std::make_unique<hw_isolation::event::Event>(
+                                 _bus, eventObjPath, id, eventSeverity,
+                                 eventMsg, associationDeftoEvent));
 
         // Update the last event id using the created event id;
         _lastEventId = id;
@@ -139,11 +146,31 @@ std::optional<sdbusplus::message::object_path> Manager::createEvent(
     return std::nullopt;
 }
 
+void Manager::addHwStatusEvent(const EventId eventId,
+                               std::unique_ptr<Event> event)
+{
+    auto inserted =
+        _hwStatusEvents.insert(std::make_pair(eventId, std::move(event)));
+    if (!inserted.second)
+    {
+        return;
+    }
+
+    for (const auto& assocEle : inserted.first->second->associations())
+    {
+        if (std::get<0>(assocEle) == "event_indicator")
+        {
+            _hwStatusEventsByHwPath.emplace(std::get<2>(assocEle), eventId);
+        }
+    }
+}
+
 void Manager::clearHardwaresStatusEvent()
 {
     // Remove all the existing hardware status event and
     // reset the last event id as "0"
     _hwStatusEvents.clear();
+    _hwStatusEventsByHwPath.clear();
     _lastEventId = 0;
 }
 
@@ -173,13 +200,39 @@ std::pair<event::EventMsg, event::EventSeverity>
     }
 }
 
-void Manager::restoreHardwaresStatusEvent(bool osRunning)
+void Manager::restoreHardwaresStatusEvent(bool osRunning, bool onlyChangedHws)
 {
-    clearHardwaresStatusEvent();
+    if (onlyChangedHws && _hwsStateInfo.empty())
+    {
+        // The hardware status events are restored from the persisted files
+        // so, the last processed hardware state is not available to find
+        // the changed hardware.
+        onlyChangedHws = false;
+    }
+
+    if (!onlyChangedHws)
+    {
+        clearHardwaresStatusEvent();
+        _hwsStateInfo.clear();
+    }
+
+    // The host might be updated the cec device tree attributes
+    // so, start the new attributes snapshot generation.
+    devtree::refreshAttrSnapshot();
+
+    // Read the required attributes directly from the phal cec device tree
+    // blob to avoid the pdbg target attribute API for all the hardware,
+    // and fall back to the pdbg if the attributes are not found.
+    devtree::DevTreeBlob devTreeBlob(PHAL_DEVTREE);
+
+    // The hardware which are processed to find the hardware that are
+    // not exist in the reloaded phal cec device tree.
+    std::set<std::string> processedHws;
 
     std::for_each(
         _requiredHwsPdbgClass.begin(), _requiredHwsPdbgClass.end(),
-        [this, osRunning](const auto& ele) {
+        [this, osRunning, onlyChangedHws, &devTreeBlob,
+         &processedHws](const auto& ele) {
             struct pdbg_target* tgt;
             pdbg_for_each_class_target(ele.c_str(), tgt)
             {
@@ -206,8 +259,11 @@ void Manager::restoreHardwaresStatusEvent(bool osRunning)
                         }
                     }
 
+                    std::string_view tgtPath{pdbg_target_path(tgt)};
+
                     ATTR_HWAS_STATE_Type hwasState;
-                    if (DT_GET_PROP(ATTR_HWAS_STATE, tgt, hwasState))
+                    if (!devTreeBlob.getHwasState(tgtPath, hwasState) &&
+                        !devtree::getHwasState(tgt, hwasState))
                     {
                         log<level::ERR>(
                             fmt::format("Skipping to create the hardware "
@@ -222,10 +278,35 @@ void Manager::restoreHardwaresStatusEvent(bool osRunning)
                         continue;
                     }
 
+                    HwState hwState{
+                        static_cast<bool>(hwasState.present),
+                        static_cast<bool>(hwasState.functional),
+                        static_cast<uint32_t>(hwasState.deconfiguredByEid)};
+                    auto& hwStateInfo = _hwsStateInfo[std::string(tgtPath)];
+                    processedHws.emplace(tgtPath);
+                    if (onlyChangedHws)
+                    {
+                        if (!hwStateInfo.second.empty() &&
+                            (hwStateInfo.first == hwState))
+                        {
+                            // Event is not required to recreate since
+                            // the hardware state is not changed.
+                            continue;
+                        }
+
+                        if (!hwStateInfo.second.empty())
+                        {
+                            clearHwStatusEventIfexists(hwStateInfo.second);
+                        }
+                    }
+                    hwStateInfo = std::make_pair(hwState, std::string());
+
                     if (hwasState.present)
                     {
                         ATTR_PHYS_BIN_PATH_Type physBinPath;
-                        if (DT_GET_PROP(ATTR_PHYS_BIN_PATH, tgt, physBinPath))
+                        if (!devTreeBlob.getPhysBinPath(tgtPath,
+                                                        physBinPath) &&
+                            DT_GET_PROP(ATTR_PHYS_BIN_PATH, tgt, physBinPath))
                         {
                             log<level::ERR>(
                                 fmt::format(
@@ -241,10 +322,8 @@ void Manager::restoreHardwaresStatusEvent(bool osRunning)
                             continue;
                         }
 
-                        devtree::DevTreePhysPath devTreePhysPath;
-                        std::copy(std::begin(physBinPath),
-                                  std::end(physBinPath),
-                                  std::back_inserter(devTreePhysPath));
+                        devtree::DevTreePhysPath devTreePhysPath(
+                            std::begin(physBinPath), std::end(physBinPath));
 
                         // TODO: It is a workaround until fix the following
                         //       issue ibm-openbmc/dev/issues/3573.
@@ -269,6 +348,12 @@ void Manager::restoreHardwaresStatusEvent(bool osRunning)
                             continue;
                         }
 
+                        hwStateInfo.second = hwInventoryPath->str;
+                        if (onlyChangedHws)
+                        {
+                            clearHwStatusEventIfexists(hwInventoryPath->str);
+                        }
+
                         event::EventMsg eventMsg;
                         event::EventSeverity eventSeverity;
                         record::entry::EntryErrLogPath eventErrLogPath;
@@ -282,11 +367,8 @@ void Manager::restoreHardwaresStatusEvent(bool osRunning)
                             if (hwasState.functional)
                             {
                                 auto functionalInInventory =
-                                    utils::getDBusPropertyVal<bool>(
-                                        _bus, hwInventoryPath->str,
-                                        "xyz.openbmc_project.State.Decorator."
-                                        "OperationalStatus",
-                                        "Functional");
+                                    inventory::isFunctional(_bus,
+                                                            *hwInventoryPath);
 
                                 if (functionalInInventory &&
                                     (hwasState.deconfiguredByEid ==
@@ -454,22 +536,114 @@ void Manager::restoreHardwaresStatusEvent(bool osRunning)
                 }
             }
         });
+
+    if (onlyChangedHws)
+    {
+        clearRemovedHwsStatusEvent(processedHws);
+    }
 }
 
-void Manager::clearHwStatusEventIfexists(const std::string& hwInventoryPath)
+void Manager::clearRemovedHwsStatusEvent(
+    const std::set<std::string>& processedHws)
 {
-    std::erase_if(_hwStatusEvents, [this, hwInventoryPath](const auto& ele) {
-        for (const auto& assocEle : ele.second->associations())
+    std::set<std::string> removedHwsInventoryPath;
+    std::erase_if(_hwsStateInfo, [&processedHws, &removedHwsInventoryPath](
+                                     const auto& hwStateInfo) {
+        if (processedHws.contains(hwStateInfo.first))
         {
-            if ((std::get<0>(assocEle) == "event_indicator") &&
-                (std::get<2>(assocEle) == hwInventoryPath))
-            {
-                return true;
-            }
+            return false;
+        }
+        if (!hwStateInfo.second.second.empty())
+        {
+            removedHwsInventoryPath.emplace(hwStateInfo.second.second);
+        }
+        return true;
+    });
+
+    // Keep the event if the inventory path is used by the existing hardware.
+    for (const auto& [tgtPath, hwStateInfo] : _hwsStateInfo)
+    {
+        removedHwsInventoryPath.erase(hwStateInfo.second);
+    }
+
+    std::ranges::for_each(removedHwsInventoryPath,
+                          [this](const auto& hwInventoryPath) {
+                              clearHwStatusEventIfexists(hwInventoryPath);
+                          });
+}
+
+void Manager::watchDevTree()
+{
+    try
+    {
+        fs::path devTreePath{PHAL_DEVTREE};
+        _devTreeLastWriteTime = fs::last_write_time(devTreePath);
+
+        // Watch the phal cec device tree directory instead of the file
+        // since the phal cec device tree might be replaced by renaming.
+        _devTreeWatch = std::make_unique<watch::inotify::Watch>(
+            _eventLoop.get(), IN_NONBLOCK, IN_CLOSE_WRITE | IN_MOVED_TO,
+            EPOLLIN, devTreePath.parent_path(),
+            std::bind(std::mem_fn(&hw_isolation::event::hw_status::Manager::
+                                      onDevTreeChange),
+                      this));
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while adding the watch on the phal "
+                        "cec device tree [{}]",
+                        e.what(), PHAL_DEVTREE)
+                .c_str());
+        error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                  error_log::Level::Informational,
+                                  error_log::CollectTraces);
+    }
+}
+
+void Manager::onDevTreeChange()
+{
+    // Defer to reload until the phal cec device tree changes are settled.
+    _devTreeReloadTimer.restartOnce(std::chrono::seconds(5));
+}
+
+void Manager::reloadDevTree()
+{
+    try
+    {
+        auto lastWriteTime = fs::last_write_time(fs::path(PHAL_DEVTREE));
+        if (lastWriteTime == _devTreeLastWriteTime)
+        {
+            // The other files are changed in the phal cec device tree
+            // directory.
+            return;
         }
+        _devTreeLastWriteTime = lastWriteTime;
+
+        devtree::reinitPHAL();
 
-        return false;
+        restoreHardwaresStatusEvent(isOSRunning(), true);
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] while reloading the phal cec "
+                        "device tree [{}]",
+                        e.what(), PHAL_DEVTREE)
+                .c_str());
+        error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                  error_log::Level::Informational,
+                                  error_log::CollectTraces);
+    }
+}
+
+void Manager::clearHwStatusEventIfexists(const std::string& hwInventoryPath)
+{
+    auto [first, last] = _hwStatusEventsByHwPath.equal_range(hwInventoryPath);
+    std::for_each(first, last, [this](const auto& ele) {
+        this->_hwStatusEvents.erase(ele.second);
     });
+    _hwStatusEventsByHwPath.erase(first, last);
 }
 
 void Manager::handleDeallocatedHw()
@@ -587,7 +761,7 @@ void Manager::onOperationalStatusChange(sdbusplus::message::message& message)
 void Manager::watchOperationalStatusChange()
 {
     constexpr auto CpuCoreIface = "xyz.openbmc_project.Inventory.Item.CpuCore";
-    auto objsToWatch = utils::getChildsInventoryPath(
+    auto objsToWatch = inventory::getChildsInventoryPath(
         _bus, std::string("/xyz/openbmc_project/inventory"), CpuCoreIface);
 
     if (!objsToWatch.has_value())
@@ -794,29 +968,26 @@ bool Manager::isOSRunning()
 
 void Manager::restorePersistedHwIsolationStatusEvent()
 {
-    auto createEventForPersistedEventFile = [this](const auto& file) {
-        auto fileEventId = std::stoul(file.path().filename());
-
-        auto eventObjPath =
-            fs::path(HW_STATUS_EVENTS_PATH) / file.path().filename();
+    auto createEventForPersistedEvent = [this](const auto& persistedEventId) {
+        auto eventObjPath = fs::path(HW_STATUS_EVENTS_PATH) /
+                            std::to_string(persistedEventId);
 
-        // All members will be filled from persisted file.
-        this->_hwStatusEvents.insert(std::make_pair(
-            fileEventId,
+        // All members will be filled from persisted event.
+        this->addHwStatusEvent(
+            persistedEventId,
             std::make_unique<hw_isolation::event::Event>(
-                this->_bus, eventObjPath, fileEventId, event::EventSeverity(),
-                event::EventMsg(), type::AssociationDef(), true)));
+                this->_bus, eventObjPath, persistedEventId,
+                event::EventSeverity(), event::EventMsg(),
+                type::AssociationDef(), true));
 
-        if (this->_lastEventId < fileEventId)
+        if (this->_lastEventId < persistedEventId)
         {
-            this->_lastEventId = fileEventId;
+            this->_lastEventId = persistedEventId;
         }
     };
 
-    std::ranges::for_each(
-        fs::directory_iterator(
-            fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path()),
-        createEventForPersistedEventFile);
+    std::ranges::for_each(journal::getIds(journal::ObjectKind::Event),
+                          createEventForPersistedEvent);
 }
 
 void Manager::restore()
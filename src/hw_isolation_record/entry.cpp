@@ -2,6 +2,7 @@
 
 #include "hw_isolation_record/entry.hpp"
 
+#include "common/persist_journal.hpp"
 #include "common/utils.hpp"
 #include "hw_isolation_record/manager.hpp"
 
@@ -11,7 +12,6 @@
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <ctime>
-#include <fstream>
 
 // Associate Entry Class with version number
 constexpr uint32_t Cereal_EntryClassVersion = 1;
@@ -24,8 +24,6 @@ namespace record
 {
 namespace entry
 {
-namespace fs = std::filesystem;
-
 using namespace phosphor::logging;
 
 Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
@@ -69,11 +67,7 @@ Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
 
 Entry::~Entry()
 {
-    fs::path path{fmt::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
-    if (fs::exists(path))
-    {
-        fs::remove(path);
-    }
+    journal::erase(journal::ObjectKind::Entry, _entryRecordId);
 }
 
 void Entry::resolveEntry(bool clearRecord)
@@ -84,18 +78,10 @@ void Entry::resolveEntry(bool clearRecord)
         {
             openpower_guard::clear(_entryRecordId);
         }
-        resolved(true);
-        for (auto& assoc : associations())
-        {
-            if (std::get<0>(assoc) == "isolated_hw")
-            {
-                hw_isolation::utils::setEnabledProperty(
-                    _bus, std::get<2>(assoc), true);
-                break;
-            }
-        }
 
-        _hwIsolationRecordMgr.eraseEntry(_entryRecordId);
+        // The record is cleared already (if requested) so, the manager
+        // should not clear it again.
+        _hwIsolationRecordMgr.resolveEntries({_entryRecordId}, false);
     }
 }
 
@@ -129,44 +115,34 @@ EntryRecordId Entry::getEntryRecId() const
 
 void Entry::serialize()
 {
-    fs::path path{fmt::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
     try
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        journal::save(journal::ObjectKind::Entry, _entryRecordId, *this);
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(fmt::format("Exception: [{}] during serialize the "
-                                    "hardware isolation entry into {}",
-                                    e.what(), path.string())
+                                    "hardware isolation entry [{}]",
+                                    e.what(), _entryRecordId)
                             .c_str());
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::Entry, _entryRecordId);
     }
 }
 
 bool Entry::deserialize()
 {
-    fs::path path{fmt::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
     try
     {
-        if (fs::exists(path))
-        {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
-            iarchive(*this);
-            return true;
-        }
-        return false;
+        return journal::load(journal::ObjectKind::Entry, _entryRecordId,
+                             *this);
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(fmt::format("Exception: [{}] during deserialize the "
-                                    "hardware isolation entry from {}",
-                                    e.what(), path.string())
+                                    "hardware isolation entry [{}]",
+                                    e.what(), _entryRecordId)
                             .c_str());
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::Entry, _entryRecordId);
         return false;
     }
 }
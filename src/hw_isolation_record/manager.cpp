@@ -5,16 +5,18 @@
 #include "hw_isolation_record/manager.hpp"
 
 #include "common/common_types.hpp"
+#include "common/io_executor.hpp"
+#include "common/persist_journal.hpp"
 #include "common/utils.hpp"
 
 #include <fmt/format.h>
 
 #include <cereal/archives/binary.hpp>
 #include <phosphor-logging/elog-errors.hpp>
+#include <sdbusplus/vtable.hpp>
 #include <xyz/openbmc_project/State/Chassis/server.hpp>
 
 #include <filesystem>
-#include <fstream>
 #include <iomanip>
 #include <ranges>
 #include <sstream>
@@ -31,77 +33,241 @@ namespace record
 using namespace phosphor::logging;
 namespace fs = std::filesystem;
 
-constexpr auto HW_ISOLATION_ENTRY_MGR_PERSIST_PATH =
-    "/var/lib/op-hw-isolation/persistdata/record_mgr/{}";
+// The maximum D-Bus method calls to send without waiting for the reply
+// while creating the D-Bus entries for the isolated hardware records.
+constexpr size_t MAX_INFLIGHT_DBUS_CALLS = 16;
+
+// The hardware isolation record file is considered as settled if it is not
+// changed for this period since the host might update it in multiple writes.
+constexpr auto GUARD_FILE_QUIET_PERIOD = std::chrono::seconds(1);
+
+// The maximum time to defer processing the hardware isolation record file
+// while it keeps changing.
+constexpr auto GUARD_FILE_MAX_SETTLE_DELAY = std::chrono::seconds(5);
+
+// The maximum inventory paths to confirm in one event loop iteration after
+// restoring from the warm-start resolution cache.
+constexpr size_t MAX_RESOLUTIONS_TO_CONFIRM = 16;
+
+/**
+ * @brief The sd-bus method handler for the Create method
+ *
+ * @details The method call is replied once the isolation is completed
+ *          (deferred reply) so, the other D-Bus requests are processed
+ *          while the isolation is waiting for the D-Bus replies.
+ */
+static int callbackCreate(sd_bus_message* msg, void* context,
+                          sd_bus_error* error)
+{
+    try
+    {
+        sdbusplus::message::message methodCall(msg);
+
+        sdbusplus::message::object_path isolateHardware;
+        std::string severity;
+        methodCall.read(isolateHardware, severity);
+
+        auto manager = static_cast<Manager*>(context);
+        dbus_async::replyLater(
+            std::move(methodCall),
+            manager->create(
+                std::move(isolateHardware),
+                entry::EntryInterface::convertTypeFromString(severity)));
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+    return 1;
+}
+
+/**
+ * @brief The sd-bus method handler for the CreateWithErrorLog method
+ *
+ * @details The method call is replied once the isolation is completed
+ *          (deferred reply).
+ */
+static int callbackCreateWithErrorLog(sd_bus_message* msg, void* context,
+                                      sd_bus_error* error)
+{
+    try
+    {
+        sdbusplus::message::message methodCall(msg);
+
+        sdbusplus::message::object_path isolateHardware;
+        std::string severity;
+        sdbusplus::message::object_path bmcErrorLog;
+        methodCall.read(isolateHardware, severity, bmcErrorLog);
+
+        auto manager = static_cast<Manager*>(context);
+        dbus_async::replyLater(
+            std::move(methodCall),
+            manager->createWithErrorLog(
+                std::move(isolateHardware),
+                entry::EntryInterface::convertTypeFromString(severity),
+                std::move(bmcErrorLog)));
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+    return 1;
+}
+
+/**
+ * @brief The sd-bus method handler for the CreateWithEntityPath method
+ *
+ * @details The method call is replied once the isolation is completed
+ *          (deferred reply).
+ */
+static int callbackCreateWithEntityPath(sd_bus_message* msg, void* context,
+                                        sd_bus_error* error)
+{
+    try
+    {
+        sdbusplus::message::message methodCall(msg);
+
+        std::vector<uint8_t> entityPath;
+        std::string severity;
+        sdbusplus::message::object_path bmcErrorLog;
+        methodCall.read(entityPath, severity, bmcErrorLog);
+
+        auto manager = static_cast<Manager*>(context);
+        dbus_async::replyLater(
+            std::move(methodCall),
+            manager->createWithEntityPath(
+                std::move(entityPath),
+                entry::EntryInterface::convertTypeFromString(severity),
+                std::move(bmcErrorLog)));
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+    return 1;
+}
+
+/**
+ * @brief The sd-bus method handler for the CreateBatch method
+ *
+ * @details The method call is replied once the isolation of all the given
+ *          hardwares is completed (deferred reply).
+ */
+static int callbackCreateBatch(sd_bus_message* msg, void* context,
+                               sd_bus_error* error)
+{
+    try
+    {
+        sdbusplus::message::message methodCall(msg);
+
+        std::vector<sdbusplus::message::object_path> isolateHardwares;
+        std::string severity;
+        sdbusplus::message::object_path bmcErrorLog;
+        methodCall.read(isolateHardwares, severity, bmcErrorLog);
+
+        auto manager = static_cast<Manager*>(context);
+        dbus_async::replyLater(
+            std::move(methodCall),
+            manager->createBatch(
+                std::move(isolateHardwares),
+                entry::EntryInterface::convertTypeFromString(severity),
+                std::move(bmcErrorLog)));
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+    return 1;
+}
+
+// The vtable of the xyz.openbmc_project.HardwareIsolation.Create interface
+static const sdbusplus::vtable::vtable_t createVtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("Create", "os", "o", callbackCreate),
+    sdbusplus::vtable::method("CreateWithErrorLog", "oso", "o",
+                              callbackCreateWithErrorLog),
+    sdbusplus::vtable::end()};
+
+// The vtable of the org.open_power.HardwareIsolation.Create interface
+static const sdbusplus::vtable::vtable_t opCreateVtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("CreateWithEntityPath", "ayso", "o",
+                              callbackCreateWithEntityPath),
+    sdbusplus::vtable::end()};
+
+// The vtable of the org.open_power.HardwareIsolation.BatchCreate interface
+static const sdbusplus::vtable::vtable_t opBatchCreateVtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("CreateBatch", "aoso", "a(os)",
+                              callbackCreateBatch),
+    sdbusplus::vtable::end()};
 
 Manager::Manager(sdbusplus::bus::bus& bus, const std::string& objPath,
                  const sdeventplus::Event& eventLoop) :
-    type::ServerObject<CreateInterface, OP_CreateInterface, DeleteAllInterface>(
-        bus, objPath.c_str()),
+    type::ServerObject<DeleteAllInterface>(bus, objPath.c_str()),
     _bus(bus), _eventLoop(eventLoop), _isolatableHWs(bus),
     _guardFileWatch(
         eventLoop.get(), IN_NONBLOCK, IN_CLOSE_WRITE, EPOLLIN,
         openpower_guard::getGuardFilePath(),
         std::bind(std::mem_fn(&hw_isolation::record::Manager::
                                   processHardwareIsolationRecordFile),
-                  this))
+                  this)),
+    _guardFileSettleTimer(
+        eventLoop,
+        std::bind(std::mem_fn(&hw_isolation::record::Manager::
+                                  onGuardFileSettleTimeout),
+                  this)),
+    _resolutionConfirmTimer(
+        eventLoop,
+        std::bind(std::mem_fn(&hw_isolation::record::Manager::
+                                  onResolutionConfirmTimeout),
+                  this)),
+    _createIface(bus, objPath.c_str(), CreateInterface::interface,
+                 createVtable, this),
+    _opCreateIface(bus, objPath.c_str(), OP_CreateInterface::interface,
+                   opCreateVtable, this),
+    _opBatchCreateIface(bus, objPath.c_str(), OP_BatchCreateInterface,
+                        opBatchCreateVtable, this),
+    _dbusCallPipeline(bus, MAX_INFLIGHT_DBUS_CALLS)
 {
-    fs::create_directories(
-        fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path());
-
     deserialize();
 }
 
 void Manager::serialize()
 {
-    fs::path path{
-        fmt::format(HW_ISOLATION_ENTRY_MGR_PERSIST_PATH, "eco_cores")};
-
     if (_persistedEcoCores.empty())
     {
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::EcoCores, 0);
         return;
     }
 
-    fs::create_directories(path.parent_path());
     try
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        journal::save(journal::ObjectKind::EcoCores, 0, *this);
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(fmt::format("Exception: [{}] during serialize the "
-                                    "eco cores physical path into {}",
-                                    e.what(), path.string())
+                                    "eco cores physical path",
+                                    e.what())
                             .c_str());
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::EcoCores, 0);
     }
 }
 
 bool Manager::deserialize()
 {
-    fs::path path{
-        fmt::format(HW_ISOLATION_ENTRY_MGR_PERSIST_PATH, "eco_cores")};
     try
     {
-        if (fs::exists(path))
-        {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
-            iarchive(*this);
-            return true;
-        }
-        return false;
+        return journal::load(journal::ObjectKind::EcoCores, 0, *this);
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(fmt::format("Exception: [{}] during deserialize the "
-                                    "eco cores physical path into {}",
-                                    e.what(), path.string())
+                                    "eco cores physical path",
+                                    e.what())
                             .c_str());
-        fs::remove(path);
+        journal::erase(journal::ObjectKind::EcoCores, 0);
         return false;
     }
 }
@@ -111,17 +277,26 @@ void Manager::updateEcoCoresList(
 {
     if (ecoCore)
     {
-        _persistedEcoCores.emplace(coreDevTreePhysPath);
+        _ecoCoresChanged |=
+            _persistedEcoCores.emplace(coreDevTreePhysPath).second;
     }
     else
     {
-        _persistedEcoCores.erase(coreDevTreePhysPath);
+        _ecoCoresChanged |= _persistedEcoCores.erase(coreDevTreePhysPath) > 0;
+    }
+}
+
+void Manager::flushEcoCores()
+{
+    if (_ecoCoresChanged)
+    {
+        serialize();
+        _ecoCoresChanged = false;
     }
-    serialize();
 }
 
-std::optional<uint32_t>
-    Manager::getEID(const sdbusplus::message::object_path& bmcErrorLog) const
+dbus_async::Task<std::optional<uint32_t>>
+    Manager::getEID(sdbusplus::message::object_path bmcErrorLog)
 {
     try
     {
@@ -135,10 +310,10 @@ std::optional<uint32_t>
             type::LoggingInterface, "GetPELIdFromBMCLogId");
 
         method.append(static_cast<uint32_t>(std::stoi(bmcErrorLog.filename())));
-        auto resp = _bus.call(method);
+        auto resp = co_await _dbusCallPipeline.awaitCall(std::move(method));
 
         resp.read(eid);
-        return eid;
+        co_return eid;
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
@@ -147,7 +322,7 @@ std::optional<uint32_t>
                                     e.what(), bmcErrorLog.str)
                             .c_str());
     }
-    return std::nullopt;
+    co_return std::nullopt;
 }
 
 std::optional<sdbusplus::message::object_path> Manager::createEntry(
@@ -180,12 +355,19 @@ std::optional<sdbusplus::message::object_path> Manager::createEntry(
                 bmcErrorLogFwdType, bmcErrorLogRevType, bmcErrorLog));
         }
 
-        _isolatedHardwares.insert(std::make_pair(
+        auto inserted = _isolatedHardwares.insert(std::make_pair(
             recordId, std::make_unique<entry::Entry>(
                           _bus, entryObjPath, *this, recordId, severity,
                           resolved, associationDeftoHw, entityPath)));
+        if (inserted.second)
+        {
+            _entriesByEntityPath.insert_or_assign(
+                devtree::convertEntityPathIntoRawData(entityPath), recordId);
+            updateInventoryPathIndex(recordId, {}, associationDeftoHw);
+        }
 
-        utils::setEnabledProperty(_bus, isolatedHardware, resolved);
+        utils::setEnabledProperty(_dbusCallPipeline, _bus, isolatedHardware,
+                                  resolved);
 
         // Update the last entry id by using the created entry id.
         return entryObjPath.string();
@@ -209,14 +391,11 @@ std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
     const std::string& isolatedHwDbusObjPath, const std::string& bmcErrorLog,
     const openpower_guard::EntityPath& entityPath)
 {
-    auto isolatedHwIt = std::find_if(
-        _isolatedHardwares.begin(), _isolatedHardwares.end(),
-        [recordId, entityPath](const auto& isolatedHw) {
-            return ((isolatedHw.second->getEntityPath() == entityPath) &&
-                    (isolatedHw.second->getEntryRecId() == recordId));
-        });
+    auto isolatedHwIt =
+        findEntry(devtree::convertEntityPathIntoRawData(entityPath));
 
-    if (isolatedHwIt == _isolatedHardwares.end())
+    if ((isolatedHwIt == _isolatedHardwares.end()) ||
+        (isolatedHwIt->second->getEntryRecId() != recordId))
     {
         // D-Bus entry does not exist
         return std::make_pair(false, std::string());
@@ -250,8 +429,11 @@ std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
         updated = true;
     }
 
-    if (isolatedHwIt->second->associations() != associationDeftoHw)
+    if (auto oldAssociations = isolatedHwIt->second->associations();
+        oldAssociations != associationDeftoHw)
     {
+        updateInventoryPathIndex(isolatedHwIt->first, oldAssociations,
+                                 associationDeftoHw);
         isolatedHwIt->second->associations(associationDeftoHw);
         updated = true;
     }
@@ -271,10 +453,11 @@ std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
     return std::make_pair(true, entryObjPath.string());
 }
 
-void Manager::isHwIsolationAllowed(const entry::EntrySeverity& severity)
+dbus_async::Task<> Manager::isHwIsolationAllowed(entry::EntrySeverity severity)
 {
     // Make sure the hardware isolation setting is enabled or not
-    if (!utils::isHwIosolationSettingEnabled(_bus))
+    if (!co_await utils::isHwIosolationSettingEnabled(_dbusCallPipeline,
+                                                      _bus))
     {
         log<level::INFO>(
             fmt::format("Hardware isolation is not allowed "
@@ -287,9 +470,10 @@ void Manager::isHwIsolationAllowed(const entry::EntrySeverity& severity)
     {
         using Chassis = sdbusplus::xyz::openbmc_project::State::server::Chassis;
 
-        auto systemPowerState = utils::getDBusPropertyVal<std::string>(
-            _bus, "/xyz/openbmc_project/state/chassis0",
-            "xyz.openbmc_project.State.Chassis", "CurrentPowerState");
+        auto systemPowerState =
+            co_await utils::getDBusPropertyVal<std::string>(
+                _dbusCallPipeline, _bus, "/xyz/openbmc_project/state/chassis0",
+                "xyz.openbmc_project.State.Chassis", "CurrentPowerState");
 
         if (Chassis::convertPowerStateFromString(systemPowerState) !=
             Chassis::PowerState::Off)
@@ -302,12 +486,12 @@ void Manager::isHwIsolationAllowed(const entry::EntrySeverity& severity)
     }
 }
 
-sdbusplus::message::object_path Manager::create(
+dbus_async::Task<sdbusplus::message::object_path> Manager::create(
     sdbusplus::message::object_path isolateHardware,
     sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
         severity)
 {
-    isHwIsolationAllowed(severity);
+    co_await isHwIsolationAllowed(severity);
 
     auto devTreePhysicalPath = _isolatableHWs.getPhysicalPath(isolateHardware);
     if (!devTreePhysicalPath.has_value())
@@ -328,38 +512,20 @@ sdbusplus::message::object_path Manager::create(
         throw type::CommonError::InvalidArgument();
     }
 
-    auto guardRecord = openpower_guard::create(
-        openpower_guard::EntityPath(devTreePhysicalPath->data(),
-                                    devTreePhysicalPath->size()),
-        0, *guardType);
-
-    if (auto ret = updateEntry(guardRecord->recordId, severity,
-                               isolateHardware.str, "", guardRecord->targetId);
-        ret.first == true)
-    {
-        return ret.second;
-    }
-    else
-    {
-        auto entryPath =
-            createEntry(guardRecord->recordId, false, severity,
-                        isolateHardware.str, "", true, guardRecord->targetId);
-
-        if (!entryPath.has_value())
-        {
-            throw type::CommonError::InternalFailure();
-        }
-        return *entryPath;
-    }
+    auto entryObjPath = isolateHw(*devTreePhysicalPath, 0, *guardType,
+                                  severity, isolateHardware.str, "");
+    flushEcoCores();
+    co_return entryObjPath;
 }
 
-sdbusplus::message::object_path Manager::createWithErrorLog(
-    sdbusplus::message::object_path isolateHardware,
-    sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
-        severity,
-    sdbusplus::message::object_path bmcErrorLog)
+dbus_async::Task<sdbusplus::message::object_path>
+    Manager::createWithErrorLog(
+        sdbusplus::message::object_path isolateHardware,
+        sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
+            severity,
+        sdbusplus::message::object_path bmcErrorLog)
 {
-    isHwIsolationAllowed(severity);
+    co_await isHwIsolationAllowed(severity);
 
     auto devTreePhysicalPath = _isolatableHWs.getPhysicalPath(isolateHardware);
     if (!devTreePhysicalPath.has_value())
@@ -370,7 +536,7 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
         throw type::CommonError::InvalidArgument();
     }
 
-    auto eId = getEID(bmcErrorLog);
+    auto eId = co_await getEID(bmcErrorLog);
     if (!eId.has_value())
     {
         log<level::ERR>(
@@ -389,64 +555,339 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
         throw type::CommonError::InvalidArgument();
     }
 
+    auto entryObjPath =
+        isolateHw(*devTreePhysicalPath, *eId, *guardType, severity,
+                  isolateHardware.str, bmcErrorLog.str);
+    flushEcoCores();
+    co_return entryObjPath;
+}
+
+sdbusplus::message::object_path
+    Manager::isolateHw(const devtree::DevTreePhysPath& devTreePhysPath,
+                       const uint32_t eId,
+                       const openpower_guard::GardType guardType,
+                       const entry::EntrySeverity severity,
+                       const std::string& isolatedHwInventoryPath,
+                       const std::string& bmcErrorLog)
+{
     auto guardRecord = openpower_guard::create(
-        openpower_guard::EntityPath(devTreePhysicalPath->data(),
-                                    devTreePhysicalPath->size()),
-        *eId, *guardType);
+        openpower_guard::EntityPath(devTreePhysPath.data(),
+                                    devTreePhysPath.size()),
+        eId, guardType);
 
-    if (auto ret =
-            updateEntry(guardRecord->recordId, severity, isolateHardware.str,
-                        bmcErrorLog.str, guardRecord->targetId);
+    if (auto ret = updateEntry(guardRecord->recordId, severity,
+                               isolatedHwInventoryPath, bmcErrorLog,
+                               guardRecord->targetId);
         ret.first == true)
     {
         return ret.second;
     }
-    else
+
+    auto entryPath =
+        createEntry(guardRecord->recordId, false, severity,
+                    isolatedHwInventoryPath, bmcErrorLog, true,
+                    guardRecord->targetId);
+
+    if (!entryPath.has_value())
+    {
+        throw type::CommonError::InternalFailure();
+    }
+    return *entryPath;
+}
+
+dbus_async::Task<BatchResults> Manager::createBatch(
+    std::vector<sdbusplus::message::object_path> isolateHardwares,
+    sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
+        severity,
+    sdbusplus::message::object_path bmcErrorLog)
+{
+    // The policy and the common arguments are validated once for
+    // all the given hardwares.
+    co_await isHwIsolationAllowed(severity);
+
+    auto guardType = entry::utils::getGuardType(severity);
+    if (!guardType.has_value())
+    {
+        log<level::ERR>(
+            fmt::format("Invalid argument [Severity: {}]",
+                        entry::EntryInterface::convertTypeToString(severity))
+                .c_str());
+        throw type::CommonError::InvalidArgument();
+    }
+
+    uint32_t eId{0};
+    std::string bmcErrorLogPath;
+    if (bmcErrorLog.str != "/")
+    {
+        auto bmcErrorLogEId = co_await getEID(bmcErrorLog);
+        if (!bmcErrorLogEId.has_value())
+        {
+            log<level::ERR>(fmt::format("Invalid argument [BmcErrorLog: {}]",
+                                        bmcErrorLog.str)
+                                .c_str());
+            throw type::CommonError::InvalidArgument();
+        }
+        eId = *bmcErrorLogEId;
+        bmcErrorLogPath = bmcErrorLog.str;
+    }
+
+    // Resolve all the given hardwares before isolating to report
+    // the invalid hardwares without isolating any hardware partially.
+    BatchResults results(isolateHardwares.size(),
+                         std::make_tuple(sdbusplus::message::object_path("/"),
+                                         std::string()));
+    std::vector<std::optional<devtree::DevTreePhysPath>> devTreePhysPaths;
+    devTreePhysPaths.reserve(isolateHardwares.size());
+    for (size_t hwIdx = 0; hwIdx < isolateHardwares.size(); ++hwIdx)
+    {
+        devTreePhysPaths.emplace_back(
+            _isolatableHWs.getPhysicalPath(isolateHardwares[hwIdx]));
+        if (!devTreePhysPaths.back().has_value())
+        {
+            log<level::ERR>(
+                fmt::format("Invalid argument [IsolateHardware: {}]",
+                            isolateHardwares[hwIdx].str)
+                    .c_str());
+            std::get<1>(results[hwIdx]) =
+                type::CommonError::InvalidArgument().name();
+        }
+    }
+
+    // Isolate all the resolved hardwares in one pass (without suspending)
+    // and continue with the other hardwares if failed to isolate one.
+    for (size_t hwIdx = 0; hwIdx < isolateHardwares.size(); ++hwIdx)
     {
-        auto entryPath = createEntry(guardRecord->recordId, false, severity,
-                                     isolateHardware.str, bmcErrorLog.str, true,
-                                     guardRecord->targetId);
+        if (!devTreePhysPaths[hwIdx].has_value())
+        {
+            continue;
+        }
 
-        if (!entryPath.has_value())
+        try
         {
-            throw type::CommonError::InternalFailure();
+            std::get<0>(results[hwIdx]) =
+                isolateHw(*devTreePhysPaths[hwIdx], eId, *guardType, severity,
+                          isolateHardwares[hwIdx].str, bmcErrorLogPath);
+        }
+        catch (const sdbusplus::exception::exception& e)
+        {
+            log<level::ERR>(fmt::format("Exception [{}] to isolate the "
+                                        "hardware [{}]",
+                                        e.what(), isolateHardwares[hwIdx].str)
+                                .c_str());
+            std::get<1>(results[hwIdx]) = e.name();
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(fmt::format("Exception [{}] to isolate the "
+                                        "hardware [{}]",
+                                        e.what(), isolateHardwares[hwIdx].str)
+                                .c_str());
+            std::get<1>(results[hwIdx]) =
+                type::CommonError::InternalFailure().name();
         }
-        return *entryPath;
     }
+    flushEcoCores();
+
+    co_return results;
 }
 
 void Manager::eraseEntry(const entry::EntryRecordId entryRecordId)
+{
+    removeEntry(entryRecordId);
+    flushEcoCores();
+}
+
+void Manager::removeEntry(const entry::EntryRecordId entryRecordId)
 {
     if (_isolatedHardwares.contains(entryRecordId))
     {
-        updateEcoCoresList(
-            false, devtree::convertEntityPathIntoRawData(
-                       _isolatedHardwares.at(entryRecordId)->getEntityPath()));
+        auto entityPath = devtree::convertEntityPathIntoRawData(
+            _isolatedHardwares.at(entryRecordId)->getEntityPath());
+
+        updateEcoCoresList(false, entityPath);
+
+        updateInventoryPathIndex(
+            entryRecordId, _isolatedHardwares.at(entryRecordId)->associations(),
+            {});
+
+        if (auto indexIt = _entriesByEntityPath.find(entityPath);
+            (indexIt != _entriesByEntityPath.end()) &&
+            (indexIt->second == entryRecordId))
+        {
+            _entriesByEntityPath.erase(indexIt);
+        }
     }
     _isolatedHardwares.erase(entryRecordId);
 }
 
+/**
+ * @brief Helper function to get the isolated hardware inventory path from
+ *        the given entry associations
+ *
+ * @param[in] associations - The entry associations
+ *
+ * @return The isolated hardware inventory path on success
+ *         Empty optional if the "isolated_hw" association is not found
+ */
+static std::optional<std::string>
+    getIsolatedHwPath(const type::AssociationDef& associations)
+{
+    auto assocIt = std::ranges::find_if(associations, [](const auto& assoc) {
+        return std::get<0>(assoc) == "isolated_hw";
+    });
+    if (assocIt == associations.end())
+    {
+        return std::nullopt;
+    }
+    return std::get<2>(*assocIt);
+}
+
+void Manager::updateInventoryPathIndex(
+    const entry::EntryRecordId recordId,
+    const type::AssociationDef& oldAssociations,
+    const type::AssociationDef& newAssociations)
+{
+    if (auto oldHwPath = getIsolatedHwPath(oldAssociations);
+        oldHwPath.has_value())
+    {
+        if (auto indexIt = _entriesByInventoryPath.find(*oldHwPath);
+            (indexIt != _entriesByInventoryPath.end()) &&
+            (indexIt->second == recordId))
+        {
+            _entriesByInventoryPath.erase(indexIt);
+        }
+    }
+
+    if (auto newHwPath = getIsolatedHwPath(newAssociations);
+        newHwPath.has_value())
+    {
+        _entriesByInventoryPath.insert_or_assign(*newHwPath, recordId);
+    }
+}
+
+IsolatedHardwares::iterator
+    Manager::findEntry(const devtree::DevTreePhysPath& entityPath)
+{
+    auto indexIt = _entriesByEntityPath.find(entityPath);
+    if (indexIt == _entriesByEntityPath.end())
+    {
+        return _isolatedHardwares.end();
+    }
+    return _isolatedHardwares.find(indexIt->second);
+}
+
 void Manager::resolveAllEntries(bool clearRecord)
 {
-    auto entryIt = _isolatedHardwares.begin();
-    while (entryIt != _isolatedHardwares.end())
+    std::vector<entry::EntryRecordId> entryRecordIds;
+    entryRecordIds.reserve(_isolatedHardwares.size());
+    std::ranges::copy(_isolatedHardwares | std::views::keys,
+                      std::back_inserter(entryRecordIds));
+
+    resolveEntries(entryRecordIds, clearRecord);
+}
+
+std::vector<entry::EntryRecordId> Manager::clearGuardRecords(
+    const std::vector<entry::EntryRecordId>& recordIds)
+{
+    if (recordIds.size() > 1)
+    {
+        // Clear all the records in a single pass of the guard record file
+        // if no other (for example, ephemeral) record exists in the file.
+        try
+        {
+            std::set<entry::EntryRecordId> recordIdsToClear(recordIds.begin(),
+                                                            recordIds.end());
+            auto onlyRecordsToClear = [this, &recordIdsToClear](
+                                          const auto& records) {
+                return std::ranges::all_of(records, [&](const auto& record) {
+                    return !isValidRecord(record.recordId) ||
+                           recordIdsToClear.contains(record.recordId);
+                });
+            };
+            if (openpower_guard::clearAllIf(onlyRecordsToClear))
+            {
+                return recordIds;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(fmt::format("Exception [{}] to clear all the "
+                                        "records, clearing one by one",
+                                        e.what())
+                                .c_str());
+        }
+    }
+
+    std::vector<entry::EntryRecordId> clearedRecordIds;
+    clearedRecordIds.reserve(recordIds.size());
+    for (const auto& recordId : recordIds)
+    {
+        // Continue other records to clear if failed to clear one record
+        try
+        {
+            openpower_guard::clear(recordId);
+            clearedRecordIds.emplace_back(recordId);
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(fmt::format("Exception [{}] to delete entry [{}]",
+                                        e.what(), recordId)
+                                .c_str());
+        }
+    }
+    return clearedRecordIds;
+}
+
+void Manager::resolveEntries(
+    const std::vector<entry::EntryRecordId>& entryRecordIds, bool clearRecord)
+{
+    std::vector<entry::EntryRecordId> recordIds;
+    recordIds.reserve(entryRecordIds.size());
+    std::ranges::copy_if(entryRecordIds, std::back_inserter(recordIds),
+                         [this](const auto& recordId) {
+                             auto entryIt = _isolatedHardwares.find(recordId);
+                             return (entryIt != _isolatedHardwares.end()) &&
+                                    !entryIt->second->resolved();
+                         });
+    if (recordIds.empty())
+    {
+        return;
+    }
+
+    if (clearRecord)
     {
-        auto entryRecordId = entryIt->first;
-        auto& entry = entryIt->second;
-        std::advance(entryIt, 1);
+        recordIds = clearGuardRecords(recordIds);
+    }
 
-        // Continue other entries to delete if failed to delete one entry
+    std::vector<std::string> isolatedHwPaths;
+    isolatedHwPaths.reserve(recordIds.size());
+    for (const auto& recordId : recordIds)
+    {
+        // Continue other entries to resolve if failed to resolve one entry
         try
         {
-            entry->resolveEntry(clearRecord);
+            auto& entry = _isolatedHardwares.at(recordId);
+            entry->resolved(true);
+            if (auto isolatedHwPath = getIsolatedHwPath(entry->associations());
+                isolatedHwPath.has_value())
+            {
+                isolatedHwPaths.emplace_back(std::move(*isolatedHwPath));
+            }
+
+            removeEntry(recordId);
         }
-        catch (std::exception& e)
+        catch (const std::exception& e)
         {
             log<level::ERR>(fmt::format("Exception [{}] to delete entry [{}]",
-                                        e.what(), entryRecordId)
+                                        e.what(), recordId)
                                 .c_str());
         }
     }
+
+    // Enable all the isolated hardware at once.
+    utils::setEnabledProperty(_dbusCallPipeline, _bus, isolatedHwPaths, true);
+
+    flushEcoCores();
 }
 
 void Manager::deleteAll()
@@ -505,27 +946,6 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
         }
         updateEcoCoresList(ecoCore, entityPathRawData);
 
-        auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
-        std::string strBmcErrorLogPath{};
-        if (!bmcErrorLogPath.has_value())
-        {
-            if (!isRestorePath)
-            {
-                log<level::ERR>(
-                    fmt::format("Skipping to restore a given isolated "
-                                "hardware [{}] : Due to failure to get BMC "
-                                "error log path "
-                                "by isolated hardware EID (aka PEL ID) [{:#X}]",
-                                ss.str(), record.elogId)
-                        .c_str());
-                return;
-            }
-        }
-        else
-        {
-            strBmcErrorLogPath = bmcErrorLogPath->str;
-        }
-
         auto entrySeverity = entry::utils::getEntrySeverityType(
             static_cast<openpower_guard::GardType>(record.errType));
         if (!entrySeverity.has_value())
@@ -539,21 +959,59 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
             return;
         }
 
-        auto entryPath =
-            createEntry(record.recordId, resolved, *entrySeverity,
-                        isolatedHwInventoryPath->str, strBmcErrorLogPath, false,
-                        record.targetId);
+        _pendingRecords.emplace(record.recordId);
 
-        if (!entryPath.has_value())
-        {
-            log<level::ERR>(
-                fmt::format(
-                    "Skipping to restore a given isolated "
-                    "hardware [{}] : Due to failure to create dbus entry",
-                    ss.str())
-                    .c_str());
-            return;
-        }
+        auto createEntryWithErrLog =
+            [this, record, resolved, entrySeverity = *entrySeverity,
+             isolatedHwInventoryPath = isolatedHwInventoryPath->str,
+             isRestorePath, entityPathStr = ss.str()](
+                const std::optional<sdbusplus::message::object_path>&
+                    bmcErrorLogPath) {
+                // The record might be dropped while waiting for the reply.
+                if (this->_pendingRecords.erase(record.recordId) == 0)
+                {
+                    return;
+                }
+
+                std::string strBmcErrorLogPath{};
+                if (!bmcErrorLogPath.has_value())
+                {
+                    if (!isRestorePath)
+                    {
+                        log<level::ERR>(
+                            fmt::format(
+                                "Skipping to restore a given isolated "
+                                "hardware [{}] : Due to failure to get BMC "
+                                "error log path "
+                                "by isolated hardware EID (aka PEL ID) [{:#X}]",
+                                entityPathStr, record.elogId)
+                                .c_str());
+                        return;
+                    }
+                }
+                else
+                {
+                    strBmcErrorLogPath = bmcErrorLogPath->str;
+                }
+
+                auto entryPath = this->createEntry(
+                    record.recordId, resolved, entrySeverity,
+                    isolatedHwInventoryPath, strBmcErrorLogPath, false,
+                    record.targetId);
+
+                if (!entryPath.has_value())
+                {
+                    log<level::ERR>(
+                        fmt::format("Skipping to restore a given isolated "
+                                    "hardware [{}] : Due to failure to create "
+                                    "dbus entry",
+                                    entityPathStr)
+                            .c_str());
+                }
+            };
+
+        utils::getBMCLogPath(_dbusCallPipeline, _bus, record.elogId,
+                             createEntryWithErrLog);
     }
     catch (const std::exception& e)
     {
@@ -593,20 +1051,6 @@ void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
     }
     updateEcoCoresList(ecoCore, entityPathRawData);
 
-    auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
-
-    if (!bmcErrorLogPath.has_value())
-    {
-        log<level::ERR>(
-            fmt::format(
-                "Skipping to restore a given isolated "
-                "hardware [{}] : Due to failure to get BMC error log path "
-                "by isolated hardware EID (aka PEL ID) [{}]",
-                ss.str(), record.elogId)
-                .c_str());
-        return;
-    }
-
     auto entrySeverity = entry::utils::getEntrySeverityType(
         static_cast<openpower_guard::GardType>(record.errType));
     if (!entrySeverity.has_value())
@@ -620,115 +1064,134 @@ void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
         return;
     }
 
-    // Add association for isolated hardware inventory path
-    // Note: Association forward and reverse type are defined as per
-    // hardware isolation design document (aka guard) and hardware isolation
-    // entry dbus interface document for hardware and error object path
-    type::AsscDefFwdType isolateHwFwdType("isolated_hw");
-    type::AsscDefRevType isolatedHwRevType("isolated_hw_entry");
-    type::AssociationDef associationDeftoHw;
-    associationDeftoHw.push_back(std::make_tuple(
-        isolateHwFwdType, isolatedHwRevType, *isolatedHwInventoryPath));
-
-    // Add errog log as Association if given
-    if (!bmcErrorLogPath->str.empty())
-    {
-        type::AsscDefFwdType bmcErrorLogFwdType("isolated_hw_errorlog");
-        type::AsscDefRevType bmcErrorLogRevType("isolated_hw_entry");
-        associationDeftoHw.push_back(std::make_tuple(
-            bmcErrorLogFwdType, bmcErrorLogRevType, *bmcErrorLogPath));
-    }
-
-    bool updated{false};
-    if (entryIt->second->severity() != entrySeverity)
-    {
-        entryIt->second->severity(*entrySeverity);
-        updated = true;
-    }
+    auto updateEntryWithErrLog =
+        [this, entryRecordId = entryIt->first, entrySeverity = *entrySeverity,
+         isolatedHwInventoryPath = *isolatedHwInventoryPath, record,
+         entityPathStr = ss.str()](
+            const std::optional<sdbusplus::message::object_path>&
+                bmcErrorLogPath) {
+            if (!bmcErrorLogPath.has_value())
+            {
+                log<level::ERR>(
+                    fmt::format(
+                        "Skipping to restore a given isolated "
+                        "hardware [{}] : Due to failure to get BMC error log "
+                        "path by isolated hardware EID (aka PEL ID) [{}]",
+                        entityPathStr, record.elogId)
+                        .c_str());
+                return;
+            }
 
-    if (entryIt->second->associations() != associationDeftoHw)
-    {
-        entryIt->second->associations(associationDeftoHw);
-        updated = true;
-    }
+            // The entry might be deleted while waiting for the reply.
+            auto entryIt = this->_isolatedHardwares.find(entryRecordId);
+            if (entryIt == this->_isolatedHardwares.end())
+            {
+                return;
+            }
 
-    utils::setEnabledProperty(_bus, *isolatedHwInventoryPath, false);
+            // Add association for isolated hardware inventory path
+            // Note: Association forward and reverse type are defined as per
+            // hardware isolation design document (aka guard) and hardware
+            // isolation entry dbus interface document for hardware and error
+            // object path
+            type::AsscDefFwdType isolateHwFwdType("isolated_hw");
+            type::AsscDefRevType isolatedHwRevType("isolated_hw_entry");
+            type::AssociationDef associationDeftoHw;
+            associationDeftoHw.push_back(std::make_tuple(
+                isolateHwFwdType, isolatedHwRevType, isolatedHwInventoryPath));
 
-    if (updated)
-    {
-        // Existing entry might be overwritten if that's meets certain
-        // overwritten conditions so update creation time.
-        std::time_t timeStamp = std::time(nullptr);
-        entryIt->second->elapsed(timeStamp);
-    }
+            // Add errog log as Association if given
+            if (!bmcErrorLogPath->str.empty())
+            {
+                type::AsscDefFwdType bmcErrorLogFwdType("isolated_hw_errorlog");
+                type::AsscDefRevType bmcErrorLogRevType("isolated_hw_entry");
+                associationDeftoHw.push_back(std::make_tuple(
+                    bmcErrorLogFwdType, bmcErrorLogRevType, *bmcErrorLogPath));
+            }
 
-    entryIt->second->serialize();
-}
+            bool updated{false};
+            if (entryIt->second->severity() != entrySeverity)
+            {
+                entryIt->second->severity(entrySeverity);
+                updated = true;
+            }
 
-void Manager::cleanupPersistedEcoCores()
-{
-    bool updated{false};
-    if (_isolatedHardwares.empty())
-    {
-        _persistedEcoCores.clear();
-        updated = true;
-    }
-    else
-    {
-        for (auto ecoCore = _persistedEcoCores.begin();
-             ecoCore != _persistedEcoCores.end();)
-        {
-            auto nextEcoCore = std::next(ecoCore, 1);
+            if (auto oldAssociations = entryIt->second->associations();
+                oldAssociations != associationDeftoHw)
+            {
+                this->updateInventoryPathIndex(
+                    entryRecordId, oldAssociations, associationDeftoHw);
+                entryIt->second->associations(associationDeftoHw);
+                updated = true;
+            }
 
-            auto isNotIsolated = std::ranges::none_of(
-                _isolatedHardwares, [ecoCore](const auto& entry) {
-                    return (entry.second->getEntityPath() ==
-                            openpower_guard::EntityPath(ecoCore->data(),
-                                                        ecoCore->size()));
-                });
+            utils::setEnabledProperty(this->_dbusCallPipeline, this->_bus,
+                                      isolatedHwInventoryPath, false);
 
-            if (isNotIsolated)
+            if (updated)
             {
-                updateEcoCoresList(false, *ecoCore);
-                updated = true;
+                // Existing entry might be overwritten if that's meets certain
+                // overwritten conditions so update creation time.
+                std::time_t timeStamp = std::time(nullptr);
+                entryIt->second->elapsed(timeStamp);
             }
 
-            ecoCore = nextEcoCore;
-        }
-    }
+            entryIt->second->serialize();
+        };
 
-    if (updated)
-    {
-        serialize();
-    }
+    utils::getBMCLogPath(_dbusCallPipeline, _bus, record.elogId,
+                         updateEntryWithErrLog);
 }
 
-void Manager::cleanupPersistedFiles()
+void Manager::cleanupPersistedEcoCores()
 {
-    auto deletePersistedEntryFileIfNotExist = [this](const auto& file) {
-        auto fileEntryId = std::stoul(file.path().filename());
-
-        if (!(this->_isolatedHardwares.contains(fileEntryId)))
-        {
-            fs::remove(file.path());
-        }
-    };
+    // Remove the eco cores which entries are not exist anymore.
+    _ecoCoresChanged |= std::erase_if(_persistedEcoCores,
+                                      [this](const auto& ecoCore) {
+                                          return this->findEntry(ecoCore) ==
+                                                 _isolatedHardwares.end();
+                                      }) > 0;
+
+    flushEcoCores();
+}
 
+void Manager::cleanupPersistedFiles()
+{
     std::ranges::for_each(
-        fs::directory_iterator(
-            fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path()),
-        deletePersistedEntryFileIfNotExist);
+        journal::getIds(journal::ObjectKind::Entry),
+        [this](const auto& persistedEntryId) {
+            if (!(this->_isolatedHardwares.contains(persistedEntryId)))
+            {
+                journal::erase(journal::ObjectKind::Entry, persistedEntryId);
+            }
+        });
 
     cleanupPersistedEcoCores();
 }
 
 void Manager::restore()
 {
+    std::vector<uint8_t> guardFileImage;
+    try
+    {
+        guardFileImage = openpower_guard::readGuardFile();
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            fmt::format("Exception [{}] to read the guard file", e.what())
+                .c_str());
+    }
+
     // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
     // because those type records are created for internal purpose to use
     // by BMC and Hostboot
     openpower_guard::GuardRecords records = openpower_guard::getAll(true);
 
+    // Keep the restored guard records to process only the changed
+    // guard records when the guard record file is updated.
+    saveGuardRecords(records, std::move(guardFileImage));
+
     auto validRecord = [this](const auto& record) {
         return this->isValidRecord(record.recordId);
     };
@@ -739,29 +1202,125 @@ void Manager::restore()
         this->createEntryForRecord(record, true);
     };
 
+    // Use the private bus connection to process only the D-Bus replies
+    // while restoring, the D-Bus requests and signals are processed
+    // once the event loop is started.
+    _dbusCallPipeline.usePrivateBus();
+
     std::ranges::for_each(validRecords, createEntry);
 
+    // The event loop is not yet running so, process the bus to create
+    // the entries as the D-Bus replies arrive.
+    _dbusCallPipeline.waitIdle();
+
     cleanupPersistedFiles();
+
+    // Confirm the inventory paths which are used from the warm-start
+    // resolution cache once the event loop is started.
+    _resolutionConfirmTimer.restartOnce(std::chrono::microseconds(0));
+}
+
+void Manager::onResolutionConfirmTimeout()
+{
+    for (size_t count = 0; count < MAX_RESOLUTIONS_TO_CONFIRM; ++count)
+    {
+        auto served = resolution_cache::takeServed();
+        if (!served.has_value())
+        {
+            resolution_cache::endWarmStart();
+            resolution_cache::persist();
+            flushEcoCores();
+            return;
+        }
+        confirmResolution(served->first, served->second);
+    }
+    flushEcoCores();
+
+    _resolutionConfirmTimer.restartOnce(std::chrono::microseconds(0));
+}
+
+void Manager::confirmResolution(
+    const resolution_cache::ResolutionKey& key,
+    const resolution_cache::Resolution& servedResolution)
+{
+    bool ecoCore{key.second};
+    auto inventoryPath = _isolatableHWs.getInventoryPath(key.first, ecoCore);
+    if (inventoryPath.has_value() &&
+        (inventoryPath->str == servedResolution.inventoryPath) &&
+        (ecoCore == servedResolution.ecoCore))
+    {
+        return;
+    }
+
+    auto entryIt = findEntry(key.first);
+    if (entryIt == _isolatedHardwares.end())
+    {
+        return;
+    }
+
+    if (!inventoryPath.has_value())
+    {
+        log<level::ERR>(
+            fmt::format("Failed to confirm the inventory path [{}] of the "
+                        "isolated hardware entry [{}] which is restored from "
+                        "the resolution cache",
+                        servedResolution.inventoryPath, entryIt->first)
+                .c_str());
+        return;
+    }
+
+    log<level::INFO>(
+        fmt::format("The inventory path [{}] of the isolated hardware entry "
+                    "[{}] which is restored from the resolution cache is "
+                    "changed to [{}]",
+                    servedResolution.inventoryPath, entryIt->first,
+                    inventoryPath->str)
+            .c_str());
+
+    auto associations = entryIt->second->associations();
+    std::ranges::for_each(associations, [&inventoryPath](auto& assoc) {
+        if (std::get<0>(assoc) == "isolated_hw")
+        {
+            std::get<2>(assoc) = inventoryPath->str;
+        }
+    });
+    updateInventoryPathIndex(entryIt->first, entryIt->second->associations(),
+                             associations);
+    entryIt->second->associations(associations);
+    entryIt->second->serialize();
+
+    updateEcoCoresList(ecoCore, key.first);
+
+    utils::setEnabledProperty(_dbusCallPipeline, _bus, *inventoryPath,
+                              entryIt->second->resolved());
+
+    // The served inventory path is disabled while restoring so, enable it
+    // back if it is not isolated by another entry.
+    if (!_entriesByInventoryPath.contains(servedResolution.inventoryPath))
+    {
+        utils::setEnabledProperty(_dbusCallPipeline, _bus,
+                                  servedResolution.inventoryPath, true);
+    }
 }
 
 void Manager::processHardwareIsolationRecordFile()
 {
     /**
-     * Start timer in the event loop to get the final isolated hardware
-     * record list which are updated by the host because of the atomicity
-     * on the partition file (which is used to store isolated hardware details)
-     * between BMC and Host.
+     * Defer to process until the hardware isolation record file changes
+     * are settled because of the atomicity on the partition file (which is
+     * used to store isolated hardware details) between BMC and Host, and
+     * process all the changes together.
      */
+    auto now = std::chrono::steady_clock::now();
+    _guardFileLastChange = now;
+
     try
     {
-        _timerObjs.emplace(
-            std::make_unique<
-                sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>>(
-                _eventLoop,
-                std::bind(std::mem_fn(&hw_isolation::record::Manager::
-                                          handleHostIsolatedHardwares),
-                          this),
-                std::chrono::seconds(5)));
+        if (!_guardFileSettleTimer.isEnabled())
+        {
+            _guardFileFirstChange = now;
+            _guardFileSettleTimer.restartOnce(GUARD_FILE_QUIET_PERIOD);
+        }
     }
     catch (const std::exception& e)
     {
@@ -773,19 +1332,149 @@ void Manager::processHardwareIsolationRecordFile()
     }
 }
 
-void Manager::handleHostIsolatedHardwares()
+void Manager::onGuardFileSettleTimeout()
 {
-    auto timerObj = std::move(_timerObjs.front());
-    _timerObjs.pop();
-    if (timerObj->isEnabled())
+    if (_guardFileReadInProgress)
     {
-        timerObj->setEnabled(false);
+        // Process the changes after processing the previous changes.
+        _guardFileSettleTimer.restartOnce(GUARD_FILE_QUIET_PERIOD);
+        return;
     }
 
-    // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
-    // because those type records are created for internal purpose to use
-    // by BMC and Hostboot
-    openpower_guard::GuardRecords records = openpower_guard::getAll(true);
+    auto now = std::chrono::steady_clock::now();
+    auto quietPeriod = now - _guardFileLastChange;
+
+    // The file might be written without the close notification
+    // (for example, the writer keeps the file open).
+    try
+    {
+        auto lastWriteTime =
+            fs::last_write_time(openpower_guard::getGuardFilePath());
+        auto writeQuietPeriod =
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                fs::file_time_type::clock::now() - lastWriteTime);
+        quietPeriod = std::clamp(writeQuietPeriod,
+                                 std::chrono::steady_clock::duration::zero(),
+                                 quietPeriod);
+    }
+    catch (const std::exception& e)
+    {
+        // Use the write notification time alone.
+        log<level::ERR>(fmt::format("Exception [{}] to get the hardware "
+                                    "isolation record file write time",
+                                    e.what())
+                            .c_str());
+    }
+
+    if ((quietPeriod < GUARD_FILE_QUIET_PERIOD) &&
+        ((now - _guardFileFirstChange) < GUARD_FILE_MAX_SETTLE_DELAY))
+    {
+        _guardFileSettleTimer.restartOnce(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                GUARD_FILE_QUIET_PERIOD - quietPeriod));
+        return;
+    }
+
+    readHostIsolatedHardwares();
+}
+
+std::vector<GuardRecordSlot>
+    Manager::saveGuardRecords(const openpower_guard::GuardRecords& records,
+                              std::vector<uint8_t>&& guardFileImage)
+{
+    std::vector<GuardRecordSlot> recordSlots;
+    recordSlots.reserve(records.size());
+    std::ranges::transform(
+        records, std::back_inserter(recordSlots), [](const auto& record) {
+            return GuardRecordSlot{
+                record.recordId, record.elogId, record.errType,
+                devtree::convertEntityPathIntoRawData(record.targetId)};
+        });
+    std::ranges::sort(recordSlots);
+
+    std::vector<GuardRecordSlot> changedRecordSlots;
+    std::ranges::set_symmetric_difference(
+        _guardRecordSlots, recordSlots, std::back_inserter(changedRecordSlots));
+
+    _guardRecordSlots = std::move(recordSlots);
+    _guardFileImage = std::move(guardFileImage);
+
+    return changedRecordSlots;
+}
+
+void Manager::readHostIsolatedHardwares()
+{
+    struct GuardFileContent
+    {
+        std::vector<uint8_t> lastImage;
+        std::vector<uint8_t> image;
+        std::optional<openpower_guard::GuardRecords> records;
+    };
+    auto content = std::make_shared<GuardFileContent>();
+    content->lastImage = _guardFileImage;
+
+    _guardFileReadInProgress = true;
+    io::submit(
+        [content]() {
+            try
+            {
+                content->image = openpower_guard::readGuardFile();
+            }
+            catch (const std::exception& e)
+            {
+                // Process the guard records without the image.
+                log<level::ERR>(fmt::format("Exception [{}] to read the "
+                                            "guard file",
+                                            e.what())
+                                    .c_str());
+            }
+
+            // Nothing to do if the guard file is rewritten with the same
+            // content
+            if (!content->image.empty() &&
+                (content->image == content->lastImage))
+            {
+                return;
+            }
+
+            // Don't get ephemeral records (GARD_Reconfig and
+            // GARD_Sticky_deconfig because those type records are created
+            // for internal purpose to use by BMC and Hostboot
+            content->records = openpower_guard::getAll(true);
+        },
+        [this, content]() {
+            this->_guardFileReadInProgress = false;
+            if (content->records.has_value())
+            {
+                this->handleHostIsolatedHardwares(
+                    std::move(content->image), std::move(*content->records));
+            }
+        });
+}
+
+void Manager::handleHostIsolatedHardwares(
+    std::vector<uint8_t>&& guardFileImage,
+    openpower_guard::GuardRecords&& records)
+{
+    auto changedRecordSlots =
+        saveGuardRecords(records, std::move(guardFileImage));
+    if (changedRecordSlots.empty())
+    {
+        // Only the ephemeral records are changed but, retry the records
+        // which entries are failed to create earlier.
+        if (createMissingEntries(records))
+        {
+            _dbusCallPipeline.onIdle([this]() {
+                this->cleanupPersistedEcoCores();
+                resolution_cache::persist();
+            });
+        }
+        return;
+    }
+
+    // The host might be updated the cec device tree attributes (for example,
+    // core ECO mode) so, start the new attributes snapshot generation.
+    devtree::refreshAttrSnapshot();
 
     // Delete all the D-Bus entries if no record in their persisted location
     if ((records.size() == 0) && _isolatedHardwares.size() > 0)
@@ -793,97 +1482,155 @@ void Manager::handleHostIsolatedHardwares()
         // Clean up all entries association before delete.
         resolveAllEntries(false);
         _isolatedHardwares.clear();
+        _entriesByEntityPath.clear();
+        _entriesByInventoryPath.clear();
+        _pendingRecords.clear();
         return;
     }
 
-    auto validRecord = [this](const auto& record) {
-        return this->isValidRecord(record.recordId);
+    /**
+     * Join the changed records and the respective entries by using
+     * the entity path (raw data) so, only the hardwares which records
+     * are added, removed or modified are reconciled.
+     */
+    struct HwRecords
+    {
+        size_t validRecordsCount{0};
+        const openpower_guard::GuardRecord* validRecord{nullptr};
     };
+    std::unordered_map<devtree::DevTreePhysPath, HwRecords,
+                       devtree::DevTreePhysPath::Hash>
+        hwRecords;
+    hwRecords.reserve(changedRecordSlots.size());
+    std::ranges::for_each(changedRecordSlots, [&hwRecords](const auto& slot) {
+        hwRecords.try_emplace(slot.entityPath);
+    });
 
-    for (auto entryIt = _isolatedHardwares.begin();
-         entryIt != _isolatedHardwares.end();)
+    for (const auto& record : records)
     {
-        auto nextEntryIt = std::next(entryIt, 1);
+        auto hwRecord = hwRecords.find(
+            devtree::convertEntityPathIntoRawData(record.targetId));
+        if (hwRecord == hwRecords.end())
+        {
+            // The hardware records are not changed
+            continue;
+        }
 
-        auto entryRecord = [entryIt](const auto& record) {
-            return entryIt->second->getEntityPath() == record.targetId;
-        };
-        auto entryRecords = records | std::views::filter(entryRecord);
+        if (isValidRecord(record.recordId))
+        {
+            ++hwRecord->second.validRecordsCount;
+            hwRecord->second.validRecord = &record;
+        }
+    }
 
-        if (entryRecords.empty())
+    // Drop the pending entry creation of the records which are removed
+    // or replaced while waiting for the D-Bus replies.
+    std::ranges::for_each(changedRecordSlots, [this, &hwRecords](
+                                                  const auto& slot) {
+        const auto& hwRecord = hwRecords.at(slot.entityPath);
+        if ((hwRecord.validRecordsCount == 0) ||
+            (hwRecord.validRecord->recordId != slot.recordId))
         {
-            entryIt->second->resolveEntry(false);
+            this->_pendingRecords.erase(slot.recordId);
         }
-        else
+    });
+
+    std::vector<entry::EntryRecordId> resolvedRecordIds;
+    for (const auto& [entityPathRawData, hwRecord] : hwRecords)
+    {
+        auto entryIt = findEntry(entityPathRawData);
+        if (entryIt == _isolatedHardwares.end())
         {
-            auto validEntryRecords =
-                entryRecords | std::views::filter(validRecord);
+            continue;
+        }
 
-            if (validEntryRecords.empty())
-            {
-                entryIt->second->resolveEntry(false);
-            }
-            else if (std::distance(validEntryRecords.begin(),
-                                   validEntryRecords.end()) == 1)
-            {
-                this->updateEntryForRecord(validEntryRecords.front(), entryIt);
-            }
-            else
-            {
-                // Should not happen since, more than one valid records
-                // for the same hardware is not allowed
-                auto entityPathRawData = devtree::convertEntityPathIntoRawData(
-                    entryIt->second->getEntityPath());
-                std::stringstream ss;
-                std::for_each(entityPathRawData.begin(),
-                              entityPathRawData.end(), [&ss](const auto& ele) {
-                                  ss << std::setw(2) << std::setfill('0')
-                                     << std::hex << (int)ele << " ";
-                              });
-                log<level::ERR>(fmt::format("More than one valid records exist "
-                                            "for the same hardware [{}]",
-                                            ss.str())
-                                    .c_str());
-            }
+        if (hwRecord.validRecordsCount == 0)
+        {
+            resolvedRecordIds.emplace_back(entryIt->first);
+        }
+        else if (hwRecord.validRecordsCount == 1)
+        {
+            this->updateEntryForRecord(*hwRecord.validRecord, entryIt);
+        }
+        else
+        {
+            // Should not happen since, more than one valid records
+            // for the same hardware is not allowed
+            std::stringstream ss;
+            std::for_each(entityPathRawData.begin(), entityPathRawData.end(),
+                          [&ss](const auto& ele) {
+                              ss << std::setw(2) << std::setfill('0')
+                                 << std::hex << (int)ele << " ";
+                          });
+            log<level::ERR>(fmt::format("More than one valid records exist "
+                                        "for the same hardware [{}]",
+                                        ss.str())
+                                .c_str());
         }
-        entryIt = nextEntryIt;
     }
 
-    auto validRecords = records | std::views::filter(validRecord);
+    resolveEntries(resolvedRecordIds, false);
 
-    auto createEntryIfNotExists = [this](const auto& validRecord) {
-        auto recordExist = [validRecord](const auto& entry) {
-            return validRecord.targetId == entry.second->getEntityPath();
-        };
+    // Create the entries for the changed records, and retry the unchanged
+    // records which entries are failed to create earlier.
+    createMissingEntries(records);
+
+    // The entries are created and updated as the D-Bus replies arrive.
+    _dbusCallPipeline.onIdle([this]() {
+        this->cleanupPersistedEcoCores();
+        resolution_cache::persist();
+    });
+}
 
-        if (std::ranges::none_of(this->_isolatedHardwares, recordExist))
+bool Manager::createMissingEntries(
+    const openpower_guard::GuardRecords& records)
+{
+    bool created{false};
+    for (const auto& record : records)
+    {
+        if (!isValidRecord(record.recordId) ||
+            _pendingRecords.contains(record.recordId) ||
+            _entriesByEntityPath.contains(
+                devtree::convertEntityPathIntoRawData(record.targetId)))
         {
-            this->createEntryForRecord(validRecord);
+            continue;
         }
-    };
 
-    std::ranges::for_each(validRecords, createEntryIfNotExists);
+        createEntryForRecord(record);
+        created = true;
+    }
 
-    cleanupPersistedEcoCores();
+    return created;
 }
 
-sdbusplus::message::object_path Manager::createWithEntityPath(
-    std::vector<uint8_t> entityPath,
-    sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
-        severity,
-    sdbusplus::message::object_path bmcErrorLog)
+dbus_async::Task<sdbusplus::message::object_path>
+    Manager::createWithEntityPath(
+        std::vector<uint8_t> entityPath,
+        sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
+            severity,
+        sdbusplus::message::object_path bmcErrorLog)
 {
-    isHwIsolationAllowed(severity);
-
-    bool ecoCore{false};
-
-    auto isolateHwInventoryPath =
-        _isolatableHWs.getInventoryPath(entityPath, ecoCore);
+    co_await isHwIsolationAllowed(severity);
 
     std::stringstream ss;
     std::for_each(entityPath.begin(), entityPath.end(), [&ss](const auto& ele) {
         ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele << " ";
     });
+    if (entityPath.size() > devtree::DevTreePhysPath::maxSize)
+    {
+        log<level::ERR>(
+            fmt::format("Invalid argument [IsolateHardware: {}]", ss.str())
+                .c_str());
+        throw type::CommonError::InvalidArgument();
+    }
+    devtree::DevTreePhysPath devTreePhysPath(
+        entityPath.data(), entityPath.data() + entityPath.size());
+
+    bool ecoCore{false};
+
+    auto isolateHwInventoryPath =
+        _isolatableHWs.getInventoryPath(devTreePhysPath, ecoCore);
+
     if (!isolateHwInventoryPath.has_value())
     {
         log<level::ERR>(
@@ -891,9 +1638,9 @@ sdbusplus::message::object_path Manager::createWithEntityPath(
                 .c_str());
         throw type::CommonError::InvalidArgument();
     }
-    updateEcoCoresList(ecoCore, entityPath);
+    updateEcoCoresList(ecoCore, devTreePhysPath);
 
-    auto eId = getEID(bmcErrorLog);
+    auto eId = co_await getEID(bmcErrorLog);
     if (!eId.has_value())
     {
         log<level::ERR>(
@@ -912,29 +1659,11 @@ sdbusplus::message::object_path Manager::createWithEntityPath(
         throw type::CommonError::InvalidArgument();
     }
 
-    auto guardRecord = openpower_guard::create(
-        openpower_guard::EntityPath(entityPath.data(), entityPath.size()), *eId,
-        *guardType);
-
-    if (auto ret = updateEntry(guardRecord->recordId, severity,
-                               isolateHwInventoryPath->str, bmcErrorLog.str,
-                               guardRecord->targetId);
-        ret.first == true)
-    {
-        return ret.second;
-    }
-    else
-    {
-        auto entryPath = createEntry(
-            guardRecord->recordId, false, severity, isolateHwInventoryPath->str,
-            bmcErrorLog.str, true, guardRecord->targetId);
-
-        if (!entryPath.has_value())
-        {
-            throw type::CommonError::InternalFailure();
-        }
-        return *entryPath;
-    }
+    auto entryObjPath =
+        isolateHw(devTreePhysPath, *eId, *guardType, severity,
+                  isolateHwInventoryPath->str, bmcErrorLog.str);
+    flushEcoCores();
+    co_return entryObjPath;
 }
 
 std::optional<std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
@@ -943,20 +1672,13 @@ std::optional<std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
 {
     // Make sure whether the given hardware inventory is exists
     // in the record list.
-    auto entryIt = std::find_if(
-        _isolatedHardwares.begin(), _isolatedHardwares.end(),
-        [hwInventoryPath](const auto& ele) {
-            for (const auto& assocEle : ele.second->associations())
-            {
-                if (std::get<0>(assocEle) == "isolated_hw")
-                {
-                    return std::get<2>(assocEle) == hwInventoryPath.str;
-                }
-            }
-
-            return false;
-        });
+    auto indexIt = _entriesByInventoryPath.find(hwInventoryPath.str);
+    if (indexIt == _entriesByInventoryPath.end())
+    {
+        return std::nullopt;
+    }
 
+    auto entryIt = _isolatedHardwares.find(indexIt->second);
     if (entryIt == _isolatedHardwares.end())
     {
         return std::nullopt;
@@ -11,6 +11,10 @@
 #include <xyz/openbmc_project/Common/File/error.hpp>
 #include <xyz/openbmc_project/HardwareIsolation/error.hpp>
 
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
 namespace hw_isolation
 {
 namespace openpower_guard
@@ -21,6 +25,12 @@ namespace FileError = sdbusplus::xyz::openbmc_project::Common::File::Error;
 namespace HardwareIsolationError =
     sdbusplus::xyz::openbmc_project::HardwareIsolation::Error;
 
+/**
+ * @brief Used to serialize the libguard interface calls since those might
+ *        be called from the I/O executor worker thread as well.
+ */
+static std::mutex libguardMutex;
+
 /**
  * @brief Helper MACRO to call libguard interface and to have
  *        common exception handler
@@ -30,6 +40,7 @@ namespace HardwareIsolationError =
 #define CALL_LIBGUARD_INTERFACE(INTERFACE_SIGNATURE)                           \
     try                                                                        \
     {                                                                          \
+        std::lock_guard<std::mutex> libguardLock(libguardMutex);               \
         INTERFACE_SIGNATURE                                                    \
     }                                                                          \
     catch (libguard::exception::GuardFileOpenFailed & e)                       \
@@ -76,6 +87,18 @@ void clear(const uint32_t recordId)
     CALL_LIBGUARD_INTERFACE(libguard::clear(recordId);)
 }
 
+bool clearAllIf(const std::function<bool(const GuardRecords&)>& canClearAll)
+{
+    bool cleared{false};
+
+    CALL_LIBGUARD_INTERFACE(if (canClearAll(libguard::getAll(false))) {
+        libguard::clearAll();
+        cleared = true;
+    })
+
+    return cleared;
+}
+
 GuardRecords getAll(bool persistentTypeOnly)
 {
     GuardRecords records;
@@ -94,5 +117,32 @@ const fs::path getGuardFilePath()
     return guardfilePath;
 }
 
+std::vector<uint8_t> readGuardFile()
+{
+    auto guardFilePath = getGuardFilePath();
+
+    std::ifstream guardFile(guardFilePath, std::ios::in | std::ios::binary);
+    if (!guardFile.is_open())
+    {
+        log<level::ERR>(fmt::format("Failed to open the guard file [{}]",
+                                    guardFilePath.string())
+                            .c_str());
+        throw FileError::Open();
+    }
+
+    std::vector<uint8_t> guardFileImage(
+        (std::istreambuf_iterator<char>(guardFile)),
+        std::istreambuf_iterator<char>());
+    if (guardFile.bad())
+    {
+        log<level::ERR>(fmt::format("Failed to read the guard file [{}]",
+                                    guardFilePath.string())
+                            .c_str());
+        throw FileError::Read();
+    }
+
+    return guardFileImage;
+}
+
 } // namespace openpower_guard
 } // namespace hw_isolation
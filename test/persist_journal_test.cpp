@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/persist_journal.hpp"
+
+#include <stdlib.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace journal
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The journal test fixture
+ *
+ * @note The I/O executor is not initialized in the tests so, the journal
+ *       writes are done in the caller thread before returning.
+ */
+class PersistJournalTest : public ::testing::Test
+{
+  protected:
+    fs::path persistDir;
+    fs::path journalPath;
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/hw_isolation_journal_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        persistDir = dirTemplate;
+        journalPath = persistDir / "journal";
+    }
+
+    void TearDown() override
+    {
+        closeJournal();
+        fs::remove_all(persistDir);
+    }
+
+    /**
+     * @brief Used to replay the journal again as the daemon restart
+     */
+    void restart()
+    {
+        closeJournal();
+        initJournal(persistDir);
+    }
+
+    static void writeFile(const fs::path& path, const std::string& data)
+    {
+        fs::create_directories(path.parent_path());
+        std::ofstream os(path, std::ios::out | std::ios::binary);
+        os << data;
+    }
+
+    static std::string readFile(const fs::path& path)
+    {
+        std::ifstream is(path, std::ios::in | std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(is),
+                           std::istreambuf_iterator<char>());
+    }
+
+    std::string getObject(ObjectKind kind, ObjectId id)
+    {
+        auto payload = get(kind, id);
+        return payload == nullptr ? std::string("<none>") : *payload;
+    }
+};
+
+TEST_F(PersistJournalTest, PutEraseRoundTrip)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    put(ObjectKind::Entry, 2, "entry2");
+    put(ObjectKind::Event, 1, "event1");
+    put(ObjectKind::Entry, 2, "entry2-updated");
+    erase(ObjectKind::Entry, 1);
+
+    restart();
+
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "<none>");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 2), "entry2-updated");
+    EXPECT_EQ(getObject(ObjectKind::Event, 1), "event1");
+    EXPECT_EQ(getIds(ObjectKind::Entry), std::vector<ObjectId>{2});
+    EXPECT_EQ(getIds(ObjectKind::Event), std::vector<ObjectId>{1});
+    EXPECT_TRUE(getIds(ObjectKind::EcoCores).empty());
+}
+
+TEST_F(PersistJournalTest, ChangesIgnoredAfterClose)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    closeJournal();
+
+    // The D-Bus objects are destroyed at the exit.
+    erase(ObjectKind::Entry, 1);
+    put(ObjectKind::Entry, 2, "entry2");
+
+    restart();
+
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 2), "<none>");
+}
+
+TEST_F(PersistJournalTest, CompactionKeepsLiveObjects)
+{
+    initJournal(persistDir);
+    put(ObjectKind::EcoCores, 0, "eco");
+
+    // Rewrite the same object until the stale records exceed the
+    // compaction threshold.
+    std::string payload(1024, 'x');
+    for (auto count = 0; count < 256; ++count)
+    {
+        payload[0] = static_cast<char>('a' + (count % 26));
+        put(ObjectKind::Entry, 1, std::string(payload));
+    }
+    EXPECT_LT(fs::file_size(journalPath), 128 * 1024);
+
+    restart();
+
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), payload);
+    EXPECT_EQ(getObject(ObjectKind::EcoCores, 0), "eco");
+}
+
+TEST_F(PersistJournalTest, TruncatedTailIgnored)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    auto validSize = fs::file_size(journalPath);
+    put(ObjectKind::Entry, 2, "entry2");
+    closeJournal();
+
+    // The last record is partially appended due to the power loss.
+    fs::resize_file(journalPath, fs::file_size(journalPath) - 3);
+
+    initJournal(persistDir);
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 2), "<none>");
+    EXPECT_EQ(fs::file_size(journalPath), validSize);
+
+    // The records are appended after the valid records.
+    put(ObjectKind::Entry, 3, "entry3");
+    restart();
+
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 3), "entry3");
+}
+
+TEST_F(PersistJournalTest, TruncatedRecordHeaderIgnored)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    auto validSize = fs::file_size(journalPath);
+    put(ObjectKind::Entry, 2, "entry2");
+    closeJournal();
+
+    // Only the part of the record header is appended.
+    fs::resize_file(journalPath, validSize + 6);
+
+    initJournal(persistDir);
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 2), "<none>");
+    EXPECT_EQ(fs::file_size(journalPath), validSize);
+}
+
+TEST_F(PersistJournalTest, CorruptedTailIgnored)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    auto validSize = fs::file_size(journalPath);
+    put(ObjectKind::Entry, 2, "entry2");
+    put(ObjectKind::Entry, 3, "entry3");
+    closeJournal();
+
+    // Corrupt the payload of the second record so, the checksum mismatch.
+    auto image = readFile(journalPath);
+    image[validSize + 16] ^= 0xFF;
+    writeFile(journalPath, image);
+
+    initJournal(persistDir);
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 2), "<none>");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 3), "<none>");
+    EXPECT_EQ(fs::file_size(journalPath), validSize);
+}
+
+TEST_F(PersistJournalTest, OversizedPayloadSizeIgnored)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    auto validSize = fs::file_size(journalPath);
+    put(ObjectKind::Entry, 2, "entry2");
+    closeJournal();
+
+    // The payload size of the second record is beyond the journal.
+    auto image = readFile(journalPath);
+    image[validSize + 7] = '\x7F';
+    writeFile(journalPath, image);
+
+    initJournal(persistDir);
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 2), "<none>");
+    EXPECT_EQ(fs::file_size(journalPath), validSize);
+}
+
+TEST_F(PersistJournalTest, InvalidHeaderReplaced)
+{
+    writeFile(journalPath, "garbage");
+
+    initJournal(persistDir);
+    EXPECT_TRUE(getIds(ObjectKind::Entry).empty());
+    EXPECT_EQ(readFile(fs::path(journalPath).concat(".invalid")), "garbage");
+
+    put(ObjectKind::Entry, 1, "entry1");
+    restart();
+
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+}
+
+TEST_F(PersistJournalTest, LegacyObjectsMigrated)
+{
+    writeFile(persistDir / "record_entry" / "1", "entry1");
+    writeFile(persistDir / "record_entry" / "7", "entry7");
+    writeFile(persistDir / "record_entry" / "invalid", "ignored");
+    writeFile(persistDir / "event" / "hw_status" / "3", "event3");
+    writeFile(persistDir / "record_mgr" / "eco_cores", "eco");
+
+    initJournal(persistDir);
+
+    EXPECT_EQ(getIds(ObjectKind::Entry), (std::vector<ObjectId>{1, 7}));
+    EXPECT_EQ(getObject(ObjectKind::Entry, 1), "entry1");
+    EXPECT_EQ(getObject(ObjectKind::Entry, 7), "entry7");
+    EXPECT_EQ(getObject(ObjectKind::Event, 3), "event3");
+    EXPECT_EQ(getObject(ObjectKind::EcoCores, 0), "eco");
+
+    EXPECT_TRUE(fs::exists(journalPath));
+    EXPECT_FALSE(fs::exists(persistDir / "record_entry"));
+    EXPECT_FALSE(fs::exists(persistDir / "event"));
+    EXPECT_FALSE(fs::exists(persistDir / "record_mgr"));
+
+    // The migrated objects are replayed from the journal.
+    restart();
+
+    EXPECT_EQ(getIds(ObjectKind::Entry), (std::vector<ObjectId>{1, 7}));
+    EXPECT_EQ(getObject(ObjectKind::Event, 3), "event3");
+    EXPECT_EQ(getObject(ObjectKind::EcoCores, 0), "eco");
+}
+
+TEST_F(PersistJournalTest, LegacyObjectsNotImportedOverJournal)
+{
+    initJournal(persistDir);
+    put(ObjectKind::Entry, 1, "entry1");
+    closeJournal();
+
+    writeFile(persistDir / "record_entry" / "2", "entry2");
+
+    initJournal(persistDir);
+    EXPECT_EQ(getIds(ObjectKind::Entry), std::vector<ObjectId>{1});
+}
+
+} // namespace journal
+} // namespace hw_isolation
@@ -0,0 +1,457 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/phal_devtree_blob.hpp"
+
+#include <endian.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace devtree
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class FdtBuilder
+ *
+ * @brief Used to create the flattened device tree blob to parse
+ */
+class FdtBuilder
+{
+  public:
+    static constexpr uint32_t MAGIC = 0xd00dfeed;
+    static constexpr uint32_t BEGIN_NODE = 0x1;
+    static constexpr uint32_t END_NODE = 0x2;
+    static constexpr uint32_t PROP = 0x3;
+    static constexpr uint32_t NOP = 0x4;
+    static constexpr uint32_t END = 0x9;
+
+    static constexpr size_t HDR_TOTALSIZE = 4;
+    static constexpr size_t HDR_OFF_DT_STRINGS = 12;
+    static constexpr size_t HDR_SIZE_DT_STRINGS = 32;
+    static constexpr size_t HDR_SIZE_DT_STRUCT = 36;
+    static constexpr size_t HDR_SIZE = 40;
+
+    void token(uint32_t value)
+    {
+        appendBE32(_struct, value);
+    }
+
+    void beginNode(const std::string& name)
+    {
+        token(BEGIN_NODE);
+        _struct.insert(_struct.end(), name.begin(), name.end());
+        _struct.push_back('\0');
+        align();
+    }
+
+    void endNode()
+    {
+        token(END_NODE);
+    }
+
+    void prop(const std::string& name, const std::vector<uint8_t>& value)
+    {
+        token(PROP);
+        token(static_cast<uint32_t>(value.size()));
+        token(addString(name));
+        _struct.insert(_struct.end(), value.begin(), value.end());
+        align();
+    }
+
+    /**
+     * @brief Used to add the property header without the value
+     */
+    void propHeader(uint32_t length, uint32_t nameOff)
+    {
+        token(PROP);
+        token(length);
+        token(nameOff);
+    }
+
+    void end()
+    {
+        token(END);
+    }
+
+    uint32_t addString(const std::string& name)
+    {
+        auto nameOff = _strings.find(name + '\0');
+        if (nameOff != std::string::npos)
+        {
+            return nameOff;
+        }
+        nameOff = _strings.size();
+        _strings.append(name);
+        _strings.push_back('\0');
+        return nameOff;
+    }
+
+    /**
+     * @brief Used to get the offset of the next struct block data in
+     *        the blob to corrupt it later.
+     */
+    size_t offset() const
+    {
+        return HDR_SIZE + _struct.size();
+    }
+
+    std::vector<uint8_t> build() const
+    {
+        std::vector<uint8_t> blob;
+        appendBE32(blob, MAGIC);
+        appendBE32(blob, HDR_SIZE + _struct.size() + _strings.size());
+        appendBE32(blob, HDR_SIZE);
+        appendBE32(blob, HDR_SIZE + _struct.size());
+        appendBE32(blob, 0);  // off_mem_rsvmap
+        appendBE32(blob, 17); // version
+        appendBE32(blob, 16); // last_comp_version
+        appendBE32(blob, 0);  // boot_cpuid_phys
+        appendBE32(blob, _strings.size());
+        appendBE32(blob, _struct.size());
+        blob.insert(blob.end(), _struct.begin(), _struct.end());
+        blob.insert(blob.end(), _strings.begin(), _strings.end());
+        return blob;
+    }
+
+    static void writeBE32(std::vector<uint8_t>& blob, size_t offset,
+                          uint32_t value)
+    {
+        value = htobe32(value);
+        std::memcpy(blob.data() + offset, &value, sizeof(value));
+    }
+
+  private:
+    std::vector<uint8_t> _struct;
+    std::string _strings;
+
+    static void appendBE32(std::vector<uint8_t>& data, uint32_t value)
+    {
+        data.resize(data.size() + sizeof(value));
+        writeBE32(data, data.size() - sizeof(value), value);
+    }
+
+    void align()
+    {
+        _struct.resize((_struct.size() + 3) & ~size_t(3));
+    }
+};
+
+/**
+ * @brief The device tree blob test fixture
+ */
+class DevTreeBlobTest : public ::testing::Test
+{
+  protected:
+    fs::path blobPath;
+    std::vector<uint8_t> physBinPath;
+
+    void SetUp() override
+    {
+        char fileTemplate[] = "/tmp/hw_isolation_devtree_XXXXXX";
+        int fd = mkstemp(fileTemplate);
+        ASSERT_GE(fd, 0);
+        close(fd);
+        blobPath = fileTemplate;
+
+        physBinPath.resize(sizeof(ATTR_PHYS_BIN_PATH_Type));
+        for (size_t idx = 0; idx < physBinPath.size(); ++idx)
+        {
+            physBinPath[idx] = static_cast<uint8_t>(idx + 1);
+        }
+    }
+
+    void TearDown() override
+    {
+        fs::remove(blobPath);
+    }
+
+    void writeBlob(const std::vector<uint8_t>& blob)
+    {
+        std::ofstream os(blobPath, std::ios::out | std::ios::binary);
+        os.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+    }
+
+    /**
+     * @brief Used to check whether the given node ATTR_PHYS_BIN_PATH is
+     *        read from the given blob.
+     */
+    bool isPhysBinPathIndexed(const std::vector<uint8_t>& blob,
+                              std::string_view nodePath = "/proc0")
+    {
+        writeBlob(blob);
+        DevTreeBlob devTreeBlob(blobPath);
+
+        ATTR_PHYS_BIN_PATH_Type value{};
+        if (!devTreeBlob.getPhysBinPath(nodePath, value))
+        {
+            return false;
+        }
+        EXPECT_EQ(std::memcmp(value, physBinPath.data(), sizeof(value)), 0);
+        return true;
+    }
+
+    /**
+     * @brief Used to add the root node with the processor node that has
+     *        ATTR_PHYS_BIN_PATH.
+     */
+    void addTree(FdtBuilder& builder)
+    {
+        builder.beginNode("");
+        builder.prop("compatible", {'i', 'b', 'm', '\0'});
+        builder.beginNode("proc0");
+        builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+        builder.beginNode("core1");
+        builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+        builder.endNode();
+        builder.endNode();
+        builder.endNode();
+    }
+};
+
+TEST_F(DevTreeBlobTest, ValidBlobIndexed)
+{
+    FdtBuilder builder;
+    builder.token(FdtBuilder::NOP);
+    addTree(builder);
+    builder.end();
+    auto blob = builder.build();
+
+    EXPECT_TRUE(isPhysBinPathIndexed(blob, "/proc0"));
+    EXPECT_TRUE(isPhysBinPathIndexed(blob, "/proc0/core1"));
+    EXPECT_FALSE(isPhysBinPathIndexed(blob, "/"));
+    EXPECT_FALSE(isPhysBinPathIndexed(blob, "/proc1"));
+}
+
+TEST_F(DevTreeBlobTest, MissingFileIgnored)
+{
+    fs::remove(blobPath);
+    DevTreeBlob devTreeBlob(blobPath);
+
+    ATTR_PHYS_BIN_PATH_Type value{};
+    EXPECT_FALSE(devTreeBlob.getPhysBinPath("/proc0", value));
+}
+
+TEST_F(DevTreeBlobTest, BlobSmallerThanHeader)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.end();
+    auto blob = builder.build();
+    blob.resize(FdtBuilder::HDR_SIZE - 1);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, InvalidMagic)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.end();
+    auto blob = builder.build();
+    blob[0] ^= 0xFF;
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, TotalSizeBeyondBlob)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.end();
+    auto blob = builder.build();
+    FdtBuilder::writeBE32(blob, FdtBuilder::HDR_TOTALSIZE, blob.size() + 1);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, StructBlockBeyondBlob)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.end();
+    auto blob = builder.build();
+    FdtBuilder::writeBE32(blob, FdtBuilder::HDR_SIZE_DT_STRUCT, 0xFFFFFFF0);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, StringsBlockBeyondBlob)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.end();
+    auto blob = builder.build();
+    FdtBuilder::writeBE32(blob, FdtBuilder::HDR_OFF_DT_STRINGS, 0xFFFFFFF0);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, PropValueBeyondStructBlock)
+{
+    FdtBuilder builder;
+    builder.beginNode("");
+    builder.beginNode("proc0");
+    auto propLenOffset = builder.offset() + sizeof(uint32_t);
+    builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+    builder.endNode();
+    builder.endNode();
+    builder.end();
+    auto blob = builder.build();
+    FdtBuilder::writeBE32(blob, propLenOffset, 0xFFFFFFF0);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, PropNameBeyondStringsBlock)
+{
+    FdtBuilder builder;
+    builder.beginNode("");
+    builder.beginNode("proc0");
+    auto nameOffOffset = builder.offset() + (2 * sizeof(uint32_t));
+    builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+    builder.endNode();
+    builder.endNode();
+    builder.end();
+    auto blob = builder.build();
+    FdtBuilder::writeBE32(blob, nameOffOffset, 0xFFFFFFF0);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, PropLengthWrapsAround)
+{
+    // The tokens to end the tree which are hidden in the property value.
+    std::vector<uint8_t> endTokens(3 * sizeof(uint32_t));
+    FdtBuilder::writeBE32(endTokens, 0, FdtBuilder::END_NODE);
+    FdtBuilder::writeBE32(endTokens, 4, FdtBuilder::END_NODE);
+    FdtBuilder::writeBE32(endTokens, 8, FdtBuilder::END);
+
+    FdtBuilder builder;
+    builder.beginNode("");
+    auto endTokensOffset = builder.offset() + (3 * sizeof(uint32_t));
+    builder.prop("compatible", endTokens);
+    builder.beginNode("proc0");
+    builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+
+    // The property value end wraps around to the hidden tokens if size_t
+    // is 32 bits.
+    auto valueOffset = builder.offset() + (3 * sizeof(uint32_t));
+    builder.propHeader(
+        static_cast<uint32_t>(0x100000000 - (valueOffset - endTokensOffset)),
+        builder.addString("invalid"));
+    builder.endNode();
+    builder.endNode();
+    builder.end();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(builder.build()));
+}
+
+TEST_F(DevTreeBlobTest, PropNameOffsetWrapsAround)
+{
+    FdtBuilder builder;
+    builder.beginNode("");
+    builder.beginNode("proc0");
+    auto nameOffOffset = builder.offset() + (2 * sizeof(uint32_t));
+    builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+    builder.endNode();
+    builder.endNode();
+    builder.end();
+    auto blob = builder.build();
+
+    // The property name offset wraps around to the valid property name
+    // if size_t is 32 bits.
+    auto stringsOff = builder.offset();
+    auto nameOff = builder.addString("ATTR_PHYS_BIN_PATH");
+    FdtBuilder::writeBE32(
+        blob, nameOffOffset,
+        static_cast<uint32_t>(0x100000000 - stringsOff + nameOff));
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, PropHeaderTruncated)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.token(FdtBuilder::PROP);
+    builder.token(0);
+    auto blob = builder.build();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, NodeNameNotTerminated)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.token(FdtBuilder::BEGIN_NODE);
+    builder.token(0x61616161); // "aaaa" without the terminator
+    auto blob = builder.build();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(blob));
+}
+
+TEST_F(DevTreeBlobTest, UnbalancedEndNode)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.endNode();
+    builder.end();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(builder.build()));
+}
+
+TEST_F(DevTreeBlobTest, NodeNotEnded)
+{
+    FdtBuilder builder;
+    builder.beginNode("");
+    builder.beginNode("proc0");
+    builder.prop("ATTR_PHYS_BIN_PATH", physBinPath);
+    builder.endNode();
+    builder.end();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(builder.build()));
+}
+
+TEST_F(DevTreeBlobTest, EndTokenMissing)
+{
+    FdtBuilder builder;
+    addTree(builder);
+
+    EXPECT_FALSE(isPhysBinPathIndexed(builder.build()));
+}
+
+TEST_F(DevTreeBlobTest, InvalidToken)
+{
+    FdtBuilder builder;
+    addTree(builder);
+    builder.token(0x5);
+    builder.end();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(builder.build()));
+}
+
+TEST_F(DevTreeBlobTest, InvalidPropLength)
+{
+    physBinPath.pop_back();
+
+    FdtBuilder builder;
+    addTree(builder);
+    builder.end();
+
+    EXPECT_FALSE(isPhysBinPathIndexed(builder.build()));
+}
+
+} // namespace devtree
+} // namespace hw_isolation